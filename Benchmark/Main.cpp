@@ -0,0 +1,643 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "ImGuiAllocator.hpp"
+#include "ImGuiCapture.hpp"
+#include "ImGuiDistanceFont.hpp"
+#include "ImGuiFontCache.hpp"
+#include "ImGuiKernel.hpp"
+#include "ImGuiRenderer.hpp"
+#include <imgui_internal.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+using namespace Plugin;
+
+/// Dimensions of the display every frame is laid out on.
+static constexpr Real32 kWidth    = 1920.0f;
+static constexpr Real32 kHeight   = 1080.0f;
+
+/// Number of frames run before measuring, so windows, tables and fonts settle first.
+static constexpr UInt32 kWarmup   = 10;
+
+/// Number of frames measured for every workload.
+static constexpr UInt32 kFrames   = 120;
+
+/// Number of elements pushed through every kernel, and how many times each kernel runs.
+static constexpr UInt32 kElements = 1 << 20;
+static constexpr UInt32 kRepeats  = 50;
+
+/// Number of rows of the table workload.
+static constexpr UInt32 kRows     = 10000;
+
+/// Number of windows of the window workload.
+static constexpr UInt32 kWindows  = 2048;
+
+/// Number of series, points per series and markers of the plotting workload.
+static constexpr UInt32 kSeries   = 16;
+static constexpr UInt32 kPoints   = 4096;
+static constexpr UInt32 kMarkers  = 16384;
+
+/// Text drawn by the zooming workloads.
+static constexpr ConstPtr<Char> kParagraph = "The quick brown fox jumps over the lazy dog. 0123456789 (){}[]<>!?#%&@";
+
+/// \brief Counters gathered over the measured frames of a workload.
+struct Sample
+{
+    /// Milliseconds spent between the start of the frames and their draw data.
+    Real64 Frame    = 0.0;
+
+    /// Milliseconds spent serializing the frames with \ref ImGuiCapture.
+    Real64 Encode   = 0.0;
+
+    /// Milliseconds spent in \ref ImGuiRenderer::Submit.
+    Real64 Submit   = 0.0;
+
+    /// Number of bytes the frames serialize to.
+    UInt64 Bytes    = 0;
+
+    /// Number of vertices and indices of the frames.
+    UInt64 Vertices = 0;
+    UInt64 Indices  = 0;
+
+    /// Number of draw calls issued by the renderer.
+    UInt64 Commands = 0;
+
+    /// Number of ImGui commands folded into a previous draw call, and how many of those sample another texture.
+    UInt64 Merged   = 0;
+    UInt64 Batched  = 0;
+
+    /// Number of ImGui commands clipped away.
+    UInt64 Culled   = 0;
+
+    /// Number of geometry bytes uploaded.
+    UInt64 Geometry = 0;
+
+    /// Number of texture uploads, and the bytes they carry.
+    UInt64 Uploads  = 0;
+    UInt64 Uploaded = 0;
+};
+
+/// Engine host handing out the null graphics service the renderer submits to, see `Benchmark/Shim`.
+static Engine::Subsystem::Host sHost;
+
+/// Keeps the output of the kernels alive, so they are not optimized away.
+static volatile UInt32 sSink = 0;
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static Real64 GetElapsed(std::chrono::steady_clock::time_point Start)
+{
+    return std::chrono::duration<Real64, std::milli>(std::chrono::steady_clock::now() - Start).count();
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static Ptr<ImGuiContext> Create(Ref<ImGuiRenderer> Renderer, Bool Batch = false)
+{
+    const Ptr<ImGuiContext> Context = ImGui::CreateContext();
+    ImGui::SetCurrentContext(Context);
+
+    Ref<ImGuiIO> IO = ImGui::GetIO();
+    IO.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+    IO.DisplaySize  = ImVec2(kWidth, kHeight);
+    IO.DeltaTime    = 1.0f / 60.0f;
+    IO.IniFilename  = nullptr;
+
+    // Initialize the renderer the same way the system does, which also applies the font cache to the atlas.
+    Renderer.Initialize(sHost);
+    Renderer.SetBatch(Batch);
+
+    ImGui::StyleColorsDark();
+    return Context;
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static void Destroy(Ptr<ImGuiContext> Context, Ref<ImGuiRenderer> Renderer, Ptr<ImFontAtlas> Atlas = nullptr)
+{
+    // Release every texture before their atlases go away.
+    Renderer.Dispose();
+
+    if (Atlas)
+    {
+        ImGui::UnregisterFontAtlas(Atlas);
+        IM_DELETE(Atlas);
+    }
+    ImGui::DestroyContext(Context);
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+template<typename Function>
+static Sample Measure(Ref<ImGuiRenderer> Renderer, Function && Workload)
+{
+    ImGuiCapture Capture;
+    Sample       Discard;
+    Sample       Result;
+
+    for (UInt32 Frame = 0; Frame < kWarmup + kFrames; ++Frame)
+    {
+        Ref<Sample> Target = (Frame < kWarmup ? Discard : Result);
+
+        // Time the same calls the system makes between Begin and End.
+        auto Start = std::chrono::steady_clock::now();
+        ImGui::NewFrame();
+        Workload(Frame);
+        ImGui::Render();
+        Target.Frame += GetElapsed(Start);
+
+        ConstRef<ImDrawData> Commands = * ImGui::GetDrawData();
+
+        // Frames are captured before they are submitted, since submitting consumes their texture operations.
+        Start = std::chrono::steady_clock::now();
+        Target.Bytes  += Capture.Encode(Commands).size();
+        Target.Encode += GetElapsed(Start);
+
+        Start = std::chrono::steady_clock::now();
+        Renderer.Submit(Commands);
+        Target.Submit += GetElapsed(Start);
+
+        ConstRef<ImGuiRenderer::Statistics> Statistics = Renderer.GetStatistics();
+        Target.Vertices += Statistics.Vertices;
+        Target.Indices  += Statistics.Indices;
+        Target.Commands += Statistics.Commands;
+        Target.Merged   += Statistics.Merged;
+        Target.Batched  += Statistics.Batched;
+        Target.Culled   += Statistics.Culled;
+        Target.Geometry += Statistics.Uploaded;
+        Target.Uploads  += Statistics.TextureUploads;
+        Target.Uploaded += Statistics.TextureBytes;
+
+        // End the frame, which recycles the transient memory the renderer allocated.
+        sHost.GetService<Graphic::Service>()->Reset();
+    }
+    return Result;
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static void Report(ConstPtr<Char> Name, ConstRef<Sample> Result)
+{
+    std::printf("%-22s %9.3f %9.3f %9.3f %10llu %9llu %9llu %8llu %7llu %7llu %7llu %10llu %7llu %10llu\n",
+        Name,
+        Result.Frame  / kFrames,
+        Result.Encode / kFrames,
+        Result.Submit / kFrames,
+        static_cast<unsigned long long>(Result.Bytes    / kFrames),
+        static_cast<unsigned long long>(Result.Vertices / kFrames),
+        static_cast<unsigned long long>(Result.Indices  / kFrames),
+        static_cast<unsigned long long>(Result.Commands / kFrames),
+        static_cast<unsigned long long>(Result.Merged   / kFrames),
+        static_cast<unsigned long long>(Result.Batched  / kFrames),
+        static_cast<unsigned long long>(Result.Culled   / kFrames),
+        static_cast<unsigned long long>(Result.Geometry / kFrames),
+        static_cast<unsigned long long>(Result.Uploads),
+        static_cast<unsigned long long>(Result.Uploaded));
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static void Fill(Real32 Width, Real32 Height)
+{
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(Width, Height));
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static void DrawTable(UInt32 Frame)
+{
+    Fill(kWidth, kHeight);
+
+    if (ImGui::Begin("Table"))
+    {
+        constexpr ImGuiTableFlags Flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY;
+
+        if (ImGui::BeginTable("Rows", 4, Flags))
+        {
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Index");
+            ImGui::TableSetupColumn("Name");
+            ImGui::TableSetupColumn("Value");
+            ImGui::TableSetupColumn("Progress");
+            ImGui::TableHeadersRow();
+
+            // Every row is submitted, as code that does not clip its rows would, while the view scrolls through them.
+            ImGui::SetScrollY(static_cast<Real32>(Frame) * 97.0f);
+
+            for (UInt32 Row = 0; Row < kRows; ++Row)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", Row);
+                ImGui::TableNextColumn();
+                ImGui::Text("Entry %u", Row);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", static_cast<Real32>(Row) * 0.001f + static_cast<Real32>(Frame));
+                ImGui::TableNextColumn();
+                ImGui::ProgressBar(static_cast<Real32>((Row + Frame) % 100) / 100.0f);
+            }
+            ImGui::EndTable();
+        }
+    }
+    ImGui::End();
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static void DrawWindows(UInt32 Frame)
+{
+    constexpr UInt32 Columns = 64;
+
+    for (UInt32 Index = 0; Index < kWindows; ++Index)
+    {
+        const Real32 X = static_cast<Real32>(Index % Columns) * 30.0f;
+        const Real32 Y = static_cast<Real32>(Index / Columns) * 30.0f;
+
+        Char Name[32];
+        std::snprintf(Name, sizeof(Name), "Window %u", Index);
+
+        ImGui::SetNextWindowPos(ImVec2(X, Y), ImGuiCond_FirstUseEver);
+        ImGui::SetNextWindowSize(ImVec2(160.0f, 80.0f), ImGuiCond_FirstUseEver);
+
+        if (ImGui::Begin(Name))
+        {
+            ImGui::Text("Frame %u", Frame);
+            ImGui::Button("Button");
+        }
+        ImGui::End();
+    }
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static void DrawPlot(UInt32 Frame)
+{
+    Fill(kWidth, kHeight);
+
+    if (ImGui::Begin("Plot"))
+    {
+        const Ptr<ImDrawList> DrawList = ImGui::GetWindowDrawList();
+        const ImVec2          Origin   = ImGui::GetCursorScreenPos();
+        const ImVec2          Extent   = ImGui::GetContentRegionAvail();
+        const Real32          Phase    = static_cast<Real32>(Frame) * 0.05f;
+
+        Vector<ImVec2> Points(kPoints);
+
+        for (UInt32 Series = 0; Series < kSeries; ++Series)
+        {
+            for (UInt32 Point = 0; Point < kPoints; ++Point)
+            {
+                const Real32 X = static_cast<Real32>(Point) / (kPoints - 1);
+                const Real32 Y = 0.5f + 0.45f * std::sin(X * 40.0f + static_cast<Real32>(Series) + Phase);
+
+                Points[Point] = ImVec2(Origin.x + X * Extent.x, Origin.y + Y * Extent.y);
+            }
+            const ImU32 Color = IM_COL32(64 + Series * 12, 160, 255, 255);
+            DrawList->AddPolyline(Points.data(), kPoints, Color, ImDrawFlags_None, 1.5f);
+        }
+
+        for (UInt32 Marker = 0; Marker < kMarkers; ++Marker)
+        {
+            const Real32 X = std::fmod(static_cast<Real32>(Marker) * 0.618034f + Phase * 0.1f, 1.0f);
+            const Real32 Y = 0.5f + 0.5f * std::sin(static_cast<Real32>(Marker) * 12.9898f);
+
+            const ImVec2 Center(Origin.x + X * Extent.x, Origin.y + Y * Extent.y);
+            DrawList->AddCircleFilled(Center, 2.0f, IM_COL32_WHITE, 6);
+        }
+    }
+    ImGui::End();
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static void DrawZoom(Ptr<ImFont> Font, UInt32 Frame)
+{
+    Fill(kWidth, kHeight);
+
+    if (ImGui::Begin("Zoom"))
+    {
+        // Grow the text by a fraction of a pixel every frame, as a zooming view would.
+        ImGui::PushFont(Font, 10.0f + static_cast<Real32>(Frame) * 0.25f);
+
+        for (UInt32 Line = 0; Line < 32; ++Line)
+        {
+            ImGui::TextUnformatted(kParagraph);
+        }
+        ImGui::PopFont();
+    }
+    ImGui::End();
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+template<typename Function>
+static void Run(ConstPtr<Char> Name, Bool Batch, Function && Workload)
+{
+    ImGuiRenderer           Renderer;
+    const Ptr<ImGuiContext> Context = Create(Renderer, Batch);
+
+    Report(Name, Measure(Renderer, Workload));
+    Destroy(Context, Renderer);
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static void RunWorkloads(Bool Batch)
+{
+    std::printf("\n%-22s %9s %9s %9s %10s %9s %9s %8s %7s %7s %7s %10s %7s %10s\n",
+        Batch ? "Workload (batched)" : "Workload", "Frame ms", "Encode ms", "Submit ms", "Bytes", "Vertices",
+        "Indices", "Commands", "Merged", "Batched", "Culled", "Geometry", "Uploads", "Uploaded");
+
+    Run("Demo window", Batch, [](UInt32) { ImGui::ShowDemoWindow(); });
+    Run("Table (10k rows)", Batch, DrawTable);
+    Run("Windows (2048)", Batch, DrawWindows);
+    Run("Plotting", Batch, DrawPlot);
+
+    // Zooming regular text bakes every new size into the atlas, while distance field text scales its reference glyphs.
+    {
+        ImGuiRenderer           Renderer;
+        const Ptr<ImGuiContext> Context = Create(Renderer, Batch);
+        const Ptr<ImFont>       Font    = ImGui::GetIO().Fonts->AddFontDefault();
+
+        Report("Zoom (regular)", Measure(Renderer, [Font](UInt32 Frame) { DrawZoom(Font, Frame); }));
+        Destroy(Context, Renderer);
+    }
+
+    {
+        ImGuiRenderer           Renderer;
+        const Ptr<ImGuiContext> Context = Create(Renderer, Batch);
+
+        const Ptr<ImFontAtlas> Atlas = IM_NEW(ImFontAtlas)();
+        Atlas->Flags           |= ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_NoMouseCursors;
+        Atlas->TexDesiredFormat = ImTextureFormat_Alpha8;
+        Atlas->SetFontLoader(ImGuiDistanceFont::GetLoader());
+
+        ImGui::RegisterFontAtlas(Atlas);
+
+        ImFontConfig Config;
+        Config.Flags = ImFontFlags_LockBakedSizes;
+
+        const Ptr<ImFont> Font = Atlas->AddFontDefault(AddressOf(Config));
+        Report("Zoom (distance field)", Measure(Renderer, [Font](UInt32 Frame) { DrawZoom(Font, Frame); }));
+
+        Destroy(Context, Renderer, Atlas);
+    }
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static Real64 MeasureStartup()
+{
+    const auto Start = std::chrono::steady_clock::now();
+
+    ImGuiRenderer           Renderer;
+    const Ptr<ImGuiContext> Context = Create(Renderer);
+    ImGui::NewFrame();
+    ImGui::ShowDemoWindow();
+
+    // Bake a few sizes besides the default one, as an application with headings and small print would.
+    for (const Real32 Size : { 10.0f, 16.0f, 20.0f, 28.0f, 40.0f })
+    {
+        ImGui::PushFont(nullptr, Size);
+        ImGui::TextUnformatted(kParagraph);
+        ImGui::PopFont();
+    }
+    ImGui::Render();
+    Renderer.Submit(* ImGui::GetDrawData());
+
+    const Real64 Elapsed = GetElapsed(Start);
+    sHost.GetService<Graphic::Service>()->Reset();
+
+    Destroy(Context, Renderer);
+    return Elapsed;
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static void RunStartup()
+{
+    const std::filesystem::path Directory = std::filesystem::temp_directory_path() / "ZyPlugin_UI_ImGui_Benchmark";
+
+    std::filesystem::remove_all(Directory);
+    std::filesystem::create_directories(Directory);
+
+    // The first run bakes every glyph and writes the cache, the second one reads the glyphs back.
+    ImGuiFontCache::SetDirectory(Directory.string());
+
+    const Real64 Cold = MeasureStartup();
+    const Real64 Warm = MeasureStartup();
+
+    ImGuiFontCache::SetDirectory("");
+    std::filesystem::remove_all(Directory);
+
+    std::printf("\n%-22s %9s\n", "Startup", "First ms");
+    std::printf("%-22s %9.3f\n", "Font cache (cold)", Cold);
+    std::printf("%-22s %9.3f\n", "Font cache (warm)", Warm);
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+template<typename Function>
+static void Time(ConstPtr<Char> Name, UInt64 Bytes, Function && Kernel)
+{
+    Kernel();
+
+    const auto Start = std::chrono::steady_clock::now();
+
+    for (UInt32 Repeat = 0; Repeat < kRepeats; ++Repeat)
+    {
+        Kernel();
+    }
+
+    const Real64 Elapsed = GetElapsed(Start) / kRepeats;
+    std::printf("%-22s %9.3f %9.3f %9.2f\n", Name, Elapsed, Elapsed * 1.0e6 / kElements, Bytes / (Elapsed * 1.0e6));
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static void RunKernels()
+{
+    Vector<ImDrawVert>                 Vertices(kElements);
+    Vector<ImGuiKernel::CompactVertex> Compact(kElements);
+    Vector<ImGuiKernel::BatchedVertex> Batched(kElements);
+    Vector<ImDrawVert>                 Copy(kElements);
+    Vector<UInt16>                     Narrow(kElements);
+    Vector<UInt16>                     NarrowOutput(kElements);
+    Vector<UInt32>                     Wide(kElements);
+    Vector<UInt32>                     WideOutput(kElements);
+
+    // Lay out vertices and indices as ImGui does: positions on the display, and indices local to each draw list.
+    for (UInt32 Index = 0; Index < kElements; ++Index)
+    {
+        const Real32 X = std::fmod(static_cast<Real32>(Index) * 0.618034f, 1.0f);
+        const Real32 Y = std::fmod(static_cast<Real32>(Index) * 0.414214f, 1.0f);
+
+        Vertices[Index] = { ImVec2(X * kWidth, Y * kHeight), ImVec2(X, Y), 0xFF000000u | Index };
+        Narrow[Index]   = static_cast<UInt16>(Index);
+        Wide[Index]     = Index & 0xFFFF;
+    }
+
+    std::printf("\n%-22s %9s %9s %9s\n", "Kernel", "Call ms", "ns/elem", "GB/s");
+
+    Time("Copy (vertices)", kElements * sizeof(ImDrawVert), [&]
+    {
+        std::memcpy(Copy.data(), Vertices.data(), kElements * sizeof(ImDrawVert));
+        sSink = sSink + Copy.back().col;
+    });
+    ImGuiKernel::Placement Placement { };
+
+    Time("Measure", kElements * sizeof(ImDrawVert), [&]
+    {
+        ImGuiKernel::Bounds Range;
+        ImGuiKernel::Measure(Vertices.data(), kElements, Range);
+        sSink = sSink + ImGuiKernel::Fit(Range, Placement);
+    });
+    Time("Pack", kElements * sizeof(ImGuiKernel::CompactVertex), [&]
+    {
+        ImGuiKernel::Pack(Vertices.data(), Compact.data(), kElements, Placement);
+        sSink = sSink + Compact.back().Color;
+    });
+    Time("Widen", kElements * sizeof(ImGuiKernel::BatchedVertex), [&]
+    {
+        ImGuiKernel::Widen(Vertices.data(), Batched.data(), kElements);
+        sSink = sSink + Batched.back().Color;
+    });
+    Time("Copy (16-bit)", kElements * sizeof(UInt16), [&]
+    {
+        std::memcpy(NarrowOutput.data(), Narrow.data(), kElements * sizeof(UInt16));
+        sSink = sSink + NarrowOutput.back();
+    });
+    Time("Rebase (16 to 16)", kElements * sizeof(UInt16), [&]
+    {
+        ImGuiKernel::Rebase(Narrow.data(), NarrowOutput.data(), kElements, 0);
+        sSink = sSink + NarrowOutput.back();
+    });
+    Time("Rebase (16 to 32)", kElements * sizeof(UInt32), [&]
+    {
+        ImGuiKernel::Rebase(Narrow.data(), WideOutput.data(), kElements, 65536);
+        sSink = sSink + WideOutput.back();
+    });
+    Time("Copy (32-bit)", kElements * sizeof(UInt32), [&]
+    {
+        std::memcpy(WideOutput.data(), Wide.data(), kElements * sizeof(UInt32));
+        sSink = sSink + WideOutput.back();
+    });
+    Time("Rebase (32 to 32)", kElements * sizeof(UInt32), [&]
+    {
+        ImGuiKernel::Rebase(Wide.data(), WideOutput.data(), kElements, 65536);
+        sSink = sSink + WideOutput.back();
+    });
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static void RunCoalesce()
+{
+    constexpr UInt32 Count = 256;
+
+    // Glyphs are packed along shelves, so the dirty rectangles of a frame sit next to each other in a few rows.
+    Vector<ImTextureRect> Source;
+    UInt64                Before = 0;
+
+    for (UInt32 Index = 0, X = 0, Y = 0; Index < Count; ++Index)
+    {
+        const UInt16 Width  = static_cast<UInt16>(6 + (Index * 7) % 19);
+        const UInt16 Height = static_cast<UInt16>(12 + (Index * 5) % 13);
+
+        if (X + Width > 1024)
+        {
+            X  = 0;
+            Y += 26;
+        }
+        Source.push_back({ static_cast<UInt16>(X), static_cast<UInt16>(Y), Width, Height });
+
+        X      += Width + 1;
+        Before += Width * Height;
+    }
+
+    Vector<ImTextureRect> Rectangles;
+    UInt64                After = 0;
+
+    const auto Start = std::chrono::steady_clock::now();
+
+    for (UInt32 Repeat = 0; Repeat < kRepeats; ++Repeat)
+    {
+        Rectangles = Source;
+        ImGuiRenderer::Coalesce(Rectangles, 1);
+    }
+
+    const Real64 Elapsed = GetElapsed(Start) / kRepeats;
+
+    for (const auto [X, Y, W, H] : Rectangles)
+    {
+        After += W * H;
+    }
+
+    std::printf("\n%-22s %9s %9s %9s %9s %10s\n",
+        "Coalesce", "Call ms", "Rects in", "Rects out", "Texels in", "Texels out");
+    std::printf("%-22s %9.3f %9zu %9zu %9llu %10llu\n",
+        "Glyph shelves",
+        Elapsed,
+        Source.size(),
+        Rectangles.size(),
+        static_cast<unsigned long long>(Before),
+        static_cast<unsigned long long>(After));
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+int main()
+{
+    // Route ImGui's allocations through the pooled allocator, as the system does before creating its context.
+    ImGuiAllocator::Install();
+
+    RunWorkloads(false);
+    RunWorkloads(true);
+    RunStartup();
+    RunKernels();
+    RunCoalesce();
+
+    const ImGuiAllocator::Statistics Memory = ImGuiAllocator::GetStatistics();
+
+    std::printf("\n%-22s %9s %9s\n", "Allocator", "Peak KiB", "Rsrv KiB");
+    std::printf("%-22s %9llu %9llu\n",
+        "ImGui",
+        static_cast<unsigned long long>(Memory.Peak / 1024),
+        static_cast<unsigned long long>(Memory.Reserved / 1024));
+    return 0;
+}
@@ -0,0 +1,378 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+#include <cstring>
+#include <memory>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// Null graphics module the benchmark compiles the renderer against, in place of the engine's. It declares only what the
+// renderer uses: transient memory lives in host memory, device objects are plain handles and techniques are ready as
+// soon as they are loaded, so every frame goes through the same translation it would on a real device.
+//
+// Everything lives in an inline namespace, so nothing clashes with the engine's own symbols when linked together.
+
+namespace Graphic
+{
+    inline namespace Null
+    {
+        /// Handle of a device object.
+        using Object = UInt32;
+
+        /// \brief Dimensionality of a texture.
+        enum class TextureLayout : UInt8
+        {
+            Texture2D,
+        };
+
+        /// \brief Pixel format of a texture.
+        enum class TextureFormat : UInt8
+        {
+            R8UIntNorm,
+            RGBA8UIntNorm,
+        };
+
+        /// \brief How often the contents of a device object change.
+        enum class Storage : UInt8
+        {
+            Immutable,
+            Dynamic,
+            Stream,
+        };
+
+        /// \brief What a device object is bound as.
+        enum class Usage : UInt8
+        {
+            Vertex,
+            Index,
+            Uniform,
+            Sample,
+        };
+
+        /// \brief Number of samples per texel of a texture.
+        enum class Multisample : UInt8
+        {
+            X1,
+        };
+
+        /// \brief Binding point of a uniform block.
+        enum class UniformScope : UInt8
+        {
+            Global,
+            Scene,
+            Material,
+            Count,
+        };
+
+        /// \brief Features of the device.
+        struct Capabilities
+        {
+            /// Whether draw calls can offset the vertices their indices refer to.
+            Bool   SupportsBaseVertex  = true;
+
+            /// Largest width and height of a texture.
+            UInt32 MaxTextureDimension = 16384;
+        };
+
+        /// \brief Describes the device.
+        struct Description
+        {
+            /// Features of the device.
+            Graphic::Capabilities Capabilities;
+        };
+
+        /// \brief Range of a buffer bound to a draw call.
+        struct Stream
+        {
+            /// Handle of the buffer.
+            Object Buffer = 0;
+
+            /// Offset of the range in bytes.
+            UInt32 Offset = 0;
+
+            /// Size of every element in bytes.
+            UInt32 Stride = 0;
+        };
+
+        /// \brief Rectangle draw calls are clipped to.
+        struct Scissor
+        {
+            Scissor() = default;
+
+            Scissor(UInt16 X, UInt16 Y, UInt16 Width, UInt16 Height)
+                : X { X }, Y { Y }, Width { Width }, Height { Height }
+            {
+            }
+
+            UInt16 X      = 0;
+            UInt16 Y      = 0;
+            UInt16 Width  = 0;
+            UInt16 Height = 0;
+        };
+
+        /// \brief How a texture is filtered and addressed.
+        struct Sampler
+        {
+            /// Whether the texture is filtered linearly.
+            Bool Linear = true;
+        };
+
+        /// \brief Fixed capacity list, filled in order.
+        template<typename Type, UInt32 Capacity>
+        struct Stack
+        {
+            void Append(ConstRef<Type> Value)
+            {
+                Values[Size++] = Value;
+            }
+
+            Array<Type, Capacity> Values;
+            UInt32                Size = 0;
+        };
+
+        /// \brief Range of indices drawn by a draw call.
+        struct Parameters
+        {
+            UInt32 Count     = 0;
+            SInt32 Base      = 0;
+            UInt32 Offset    = 0;
+            UInt32 Instances = 0;
+        };
+
+        /// \brief Draw call, with every state it binds.
+        struct Command
+        {
+            Graphic::Scissor    Scissor;
+            Object              Pipeline = 0;
+            Stack<Stream, 4>    Vertices;
+            Stream              Indices;
+            Array<Stream, 3>    Uniforms;
+            Stack<Object, 8>    Textures;
+            Stack<Sampler, 8>   Samplers;
+            Graphic::Parameters Parameters;
+        };
+
+        /// \brief Memory handed out for the current frame only.
+        template<typename Type>
+        class Transient final
+        {
+        public:
+
+            Transient(Ptr<Type> Data, ConstRef<Stream> Stream)
+                : mData   { Data },
+                  mStream { Stream }
+            {
+            }
+
+            Ref<Type> operator[](UInt32 Index) const
+            {
+                return mData[Index];
+            }
+
+            void Copy(ConstSpan<Type> Source, UInt32 Offset)
+            {
+                std::memcpy(mData + Offset, Source.data(), Source.size() * sizeof(Type));
+            }
+
+            ConstRef<Stream> GetStream() const
+            {
+                return mStream;
+            }
+
+        private:
+
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+            Ptr<Type> mData;
+            Stream    mStream;
+        };
+
+        /// \brief Device without a backend, which keeps transient memory in host memory and discards every upload.
+        class Service final
+        {
+        public:
+
+            /// Describes the device.
+            ///
+            /// \return The description of the device.
+            ConstRef<Description> GetDescription() const
+            {
+                return mDescription;
+            }
+
+            /// Allocates vertices for the current frame.
+            ///
+            /// \param Count The number of vertices.
+            /// \return The vertices, valid until \ref Reset.
+            template<typename Type>
+            Transient<Type> AllocateTransientVertices(UInt32 Count)
+            {
+                return Allocate<Type>(Count);
+            }
+
+            /// Allocates indices for the current frame.
+            ///
+            /// \param Count The number of indices.
+            /// \return The indices, valid until \ref Reset.
+            template<typename Type>
+            Transient<Type> AllocateTransientIndices(UInt32 Count)
+            {
+                return Allocate<Type>(Count);
+            }
+
+            /// Allocates uniform blocks for the current frame.
+            ///
+            /// \param Count The number of blocks.
+            /// \return The blocks, valid until \ref Reset.
+            template<typename Type>
+            Transient<Type> AllocateTransientUniforms(UInt32 Count)
+            {
+                return Allocate<Type>(Count);
+            }
+
+            /// Allocates draw calls for the current frame.
+            ///
+            /// \param Count The number of draw calls.
+            /// \return The draw calls, valid until \ref Reset.
+            Transient<Command> AllocateTransientCommands(UInt32 Count)
+            {
+                return Allocate<Command>(Count);
+            }
+
+            /// Creates a texture, discarding its contents.
+            ///
+            /// \return The handle of the texture.
+            Object CreateTexture(
+                TextureLayout, TextureFormat, Storage, Usage, UInt32, UInt32, UInt32, Multisample, Blob)
+            {
+                return ++mObjects;
+            }
+
+            /// Updates a region of a texture, discarding its contents.
+            void UpdateTexture(Object, UInt8, UInt32, UInt32, UInt32, UInt32, UInt32, Blob)
+            {
+            }
+
+            /// Deletes a texture.
+            void DeleteTexture(Object)
+            {
+            }
+
+            /// Creates a buffer, discarding its contents.
+            ///
+            /// \return The handle of the buffer.
+            Object CreateBuffer(Usage, Storage, Blob)
+            {
+                return ++mObjects;
+            }
+
+            /// Updates a buffer, discarding its contents.
+            void UpdateBuffer(Object, UInt32, Blob)
+            {
+            }
+
+            /// Deletes a buffer.
+            void DeleteBuffer(Object)
+            {
+            }
+
+            /// Ends the frame, which recycles every transient allocation made since the last call.
+            void Reset()
+            {
+                mPage = 0;
+            }
+
+        private:
+
+            /// Hands out one page per allocation, so earlier allocations never move while the frame grows.
+            template<typename Type>
+            Transient<Type> Allocate(UInt32 Count)
+            {
+                if (mPage == mPages.size())
+                {
+                    mPages.emplace_back();
+                }
+
+                Ref<Vector<Byte>> Page = mPages[mPage++];
+                Page.resize(Max<size_t>(Page.size(), Count * sizeof(Type)));
+
+                const Ptr<Type> Data = reinterpret_cast<Ptr<Type>>(Page.data());
+                std::uninitialized_default_construct_n(Data, Count);
+
+                return Transient<Type>(Data, Stream { mPage, 0, static_cast<UInt32>(sizeof(Type)) });
+            }
+
+        private:
+
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+            Description          mDescription;
+            Vector<Vector<Byte>> mPages;
+            UInt32               mPage    = 0;
+            Object               mObjects = 0;
+        };
+
+        /// \brief Technique that is ready as soon as it is loaded.
+        class Technique final
+        {
+        public:
+
+            explicit Technique(Object Handle)
+                : mHandle { Handle }
+            {
+            }
+
+            Bool HasCompleted() const
+            {
+                return true;
+            }
+
+            Object GetHandle() const
+            {
+                return mHandle;
+            }
+
+        private:
+
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+            Object mHandle;
+        };
+    }
+}
+
+namespace Engine::Subsystem
+{
+    inline namespace Null
+    {
+        /// \brief Host handing out one instance of every service, created the first time it is requested.
+        class Host final
+        {
+        public:
+
+            template<typename Type>
+            Retainer<Type> GetService()
+            {
+                static Retainer<Type> sService(new Type());
+                return sService;
+            }
+        };
+    }
+}
@@ -0,0 +1,370 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "ImGuiAllocator.hpp"
+#include <imgui.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// Size of the header preceding every block, which keeps the blocks aligned for any fundamental type.
+    static constexpr UInt32 kHeaderSize   = 16;
+
+    /// Size of the smallest block served by the pools, header included.
+    static constexpr UInt32 kMinimumBlock = 32;
+
+    /// Number of size classes, each one serving blocks twice as large as the previous one.
+    static constexpr UInt32 kClassCount   = 7;
+
+    /// Size of the chunks the pooled blocks are carved from.
+    static constexpr UInt32 kChunkSize    = 64 * 1024;
+
+    /// Number of bytes reserved for every chunk, including the count of its live blocks that follows it.
+    static constexpr UInt32 kChunkBytes   = kChunkSize + sizeof(UInt32);
+
+    /// \brief Header preceding every block.
+    struct ImGuiAllocatorHeader
+    {
+        /// Chunk the block was carved from, or the block itself for blocks forwarded to the heap.
+        Ptr<Byte> Chunk;
+
+        /// Size class of the block, or \ref kClassCount for blocks forwarded to the heap.
+        UInt32    Class;
+
+        /// Number of bytes requested by ImGui.
+        UInt32    Size;
+    };
+    static_assert(sizeof(ImGuiAllocatorHeader) <= kHeaderSize, "The header does not fit before the block");
+
+    /// \brief State shared by every allocation.
+    struct ImGuiAllocatorState
+    {
+        /// Serializes the pools, since contexts may build their frames on different threads.
+        std::mutex                             Mutex;
+
+        /// Head of the free list of every size class.
+        Array<Ptr<Byte>, kClassCount>          Free { };
+
+        /// Chunks carved by every size class.
+        Array<Vector<Ptr<Byte>>, kClassCount>  Chunks;
+
+        /// Chunks of every size class sorted by address, used to recognize the pooled blocks.
+        Vector<Ptr<Byte>>                      Spans;
+
+        /// Free function installed before the allocator, which releases the blocks allocated before it.
+        ImGuiMemFreeFunc                       Fallback = nullptr;
+
+        /// User data of the previous free function.
+        Ptr<void>                              FallbackUser = nullptr;
+
+        /// Counters of the allocator, updated without the lock so forwarded blocks never take it.
+        std::atomic<UInt64>                    Live        = 0;
+        std::atomic<UInt64>                    Peak        = 0;
+        std::atomic<UInt64>                    Reserved    = 0;
+        std::atomic<UInt64>                    Allocations = 0;
+
+        /// Whether ImGui's allocations are routed through the allocator.
+        Bool                                   Installed = false;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ref<ImGuiAllocatorState> GetState()
+    {
+        // Never destroyed, since ImGui may still free blocks while static objects are being destroyed.
+        static const Ptr<ImGuiAllocatorState> State = new ImGuiAllocatorState();
+        return * State;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ref<Ptr<Byte>> GetNext(Ptr<Byte> Block)
+    {
+        // Free blocks link to each other through their first payload bytes, the header stays intact.
+        return * reinterpret_cast<Ptr<Ptr<Byte>>>(Block + kHeaderSize);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ref<UInt32> GetUsed(Ptr<Byte> Chunk)
+    {
+        return * reinterpret_cast<Ptr<UInt32>>(Chunk + kChunkSize);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ptr<ImGuiAllocatorHeader> GetHeader(Ptr<Byte> Block)
+    {
+        return reinterpret_cast<Ptr<ImGuiAllocatorHeader>>(Block);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool Carve(Ref<ImGuiAllocatorState> State, UInt32 Class)
+    {
+        const Ptr<Byte> Chunk = static_cast<Ptr<Byte>>(std::malloc(kChunkBytes));
+
+        if (Chunk == nullptr)
+        {
+            return false;
+        }
+
+        State.Chunks[Class].push_back(Chunk);
+        State.Spans.insert(std::upper_bound(State.Spans.begin(), State.Spans.end(), Chunk), Chunk);
+        State.Reserved.fetch_add(kChunkBytes, std::memory_order_relaxed);
+
+        GetUsed(Chunk) = 0;
+
+        const UInt32 Size = kMinimumBlock << Class;
+
+        for (UInt32 Offset = 0; Offset + Size <= kChunkSize; Offset += Size)
+        {
+            const Ptr<Byte> Block = Chunk + Offset;
+            new (Block) ImGuiAllocatorHeader { Chunk, Class, 0 };
+
+            GetNext(Block)     = State.Free[Class];
+            State.Free[Class] = Block;
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool IsPooled(ConstRef<ImGuiAllocatorState> State, ConstPtr<Byte> Pointer)
+    {
+        // The blocks never straddle chunks, so a pooled pointer lies within the last chunk starting at or before it.
+        const auto Iterator = std::upper_bound(State.Spans.begin(), State.Spans.end(), Pointer);
+        return Iterator != State.Spans.begin() && Pointer < * std::prev(Iterator) + kChunkSize;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool IsForwarded(Ptr<Byte> Block)
+    {
+        // A pooled header points to its chunk with a smaller class, and the bytes preceding a block allocated before
+        // the allocator (the heap's own bookkeeping) never hold a pointer to themselves next to this class.
+        const ConstPtr<ImGuiAllocatorHeader> Header = GetHeader(Block);
+        return Header->Class == kClassCount && Header->Chunk == Block;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Account(Ref<ImGuiAllocatorState> State, UInt64 Size)
+    {
+        const UInt64 Live = State.Live.fetch_add(Size, std::memory_order_relaxed) + Size;
+        UInt64       Peak = State.Peak.load(std::memory_order_relaxed);
+
+        while (Peak < Live && !State.Peak.compare_exchange_weak(Peak, Live, std::memory_order_relaxed))
+        {
+        }
+        State.Allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ptr<void> OnAllocate(size_t Size, Ptr<void> User)
+    {
+        Ref<ImGuiAllocatorState> State = * static_cast<Ptr<ImGuiAllocatorState>>(User);
+
+        const size_t Total = Size + kHeaderSize;
+        UInt32       Class = 0;
+
+        while (Class < kClassCount && (kMinimumBlock << Class) < Total)
+        {
+            ++Class;
+        }
+
+        Ptr<Byte> Block;
+
+        if (Class == kClassCount)
+        {
+            // Forwarded blocks are recognized by their header alone, so they never take the lock.
+            Block = static_cast<Ptr<Byte>>(std::malloc(Total));
+
+            if (Block == nullptr)
+            {
+                return nullptr;
+            }
+            new (Block) ImGuiAllocatorHeader { Block, kClassCount, static_cast<UInt32>(Size) };
+
+            State.Reserved.fetch_add(Total, std::memory_order_relaxed);
+        }
+        else
+        {
+            const std::lock_guard Guard(State.Mutex);
+
+            if (State.Free[Class] == nullptr && !Carve(State, Class))
+            {
+                return nullptr;
+            }
+
+            Block = State.Free[Class];
+            State.Free[Class] = GetNext(Block);
+
+            GetHeader(Block)->Size = static_cast<UInt32>(Size);
+            ++GetUsed(GetHeader(Block)->Chunk);
+        }
+
+        Account(State, Size);
+        return Block + kHeaderSize;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void OnFree(Ptr<void> Pointer, Ptr<void> User)
+    {
+        if (Pointer == nullptr)
+        {
+            return;
+        }
+
+        Ref<ImGuiAllocatorState> State = * static_cast<Ptr<ImGuiAllocatorState>>(User);
+
+        const Ptr<Byte>                 Block  = static_cast<Ptr<Byte>>(Pointer) - kHeaderSize;
+        const Ptr<ImGuiAllocatorHeader> Header = GetHeader(Block);
+
+        if (IsForwarded(Block))
+        {
+            State.Live.fetch_sub(Header->Size, std::memory_order_relaxed);
+            State.Reserved.fetch_sub(Header->Size + kHeaderSize, std::memory_order_relaxed);
+            std::free(Block);
+            return;
+        }
+
+        std::unique_lock Guard(State.Mutex);
+
+        if (!IsPooled(State, static_cast<ConstPtr<Byte>>(Pointer)))
+        {
+            // The block was allocated before the allocator was installed, hand it back to the function that owns it.
+            const ImGuiMemFreeFunc Fallback     = State.Fallback;
+            const Ptr<void>        FallbackUser = State.FallbackUser;
+
+            Guard.unlock();
+
+            if (Fallback)
+            {
+                Fallback(Pointer, FallbackUser);
+            }
+            else
+            {
+                std::free(Pointer);
+            }
+        }
+        else
+        {
+            State.Live.fetch_sub(Header->Size, std::memory_order_relaxed);
+            --GetUsed(Header->Chunk);
+
+            GetNext(Block)             = State.Free[Header->Class];
+            State.Free[Header->Class] = Block;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiAllocator::Install()
+    {
+        Ref<ImGuiAllocatorState> State = GetState();
+
+        const std::lock_guard Guard(State.Mutex);
+
+        if (!State.Installed)
+        {
+            ImGuiMemAllocFunc Allocate;
+            ImGui::GetAllocatorFunctions(AddressOf(Allocate), AddressOf(State.Fallback), AddressOf(State.FallbackUser));
+            ImGui::SetAllocatorFunctions(OnAllocate, OnFree, AddressOf(State));
+            State.Installed = true;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiAllocator::Trim()
+    {
+        Ref<ImGuiAllocatorState> State = GetState();
+
+        const std::lock_guard Guard(State.Mutex);
+
+        // Every chunk counts its live blocks, so finding the empty ones needs neither a scan nor any allocation.
+        for (UInt32 Class = 0; Class < kClassCount; ++Class)
+        {
+            Ref<Vector<Ptr<Byte>>> Chunks = State.Chunks[Class];
+
+            if (std::none_of(Chunks.begin(), Chunks.end(), [](Ptr<Byte> Chunk) { return GetUsed(Chunk) == 0; }))
+            {
+                continue;
+            }
+
+            // Unlink the blocks of the empty chunks before handing the chunks back to the heap.
+            for (Ptr<Ptr<Byte>> Link = AddressOf(State.Free[Class]); * Link;)
+            {
+                if (GetUsed(GetHeader(* Link)->Chunk) == 0)
+                {
+                    * Link = GetNext(* Link);
+                }
+                else
+                {
+                    Link = AddressOf(GetNext(* Link));
+                }
+            }
+
+            std::erase_if(Chunks, [&](Ptr<Byte> Chunk)
+            {
+                if (GetUsed(Chunk) != 0)
+                {
+                    return false;
+                }
+
+                std::erase(State.Spans, Chunk);
+                std::free(Chunk);
+                State.Reserved.fetch_sub(kChunkBytes, std::memory_order_relaxed);
+                return true;
+            });
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ImGuiAllocator::Statistics ImGuiAllocator::GetStatistics()
+    {
+        ConstRef<ImGuiAllocatorState> State = GetState();
+
+        Statistics Counters;
+        Counters.Live        = State.Live.load(std::memory_order_relaxed);
+        Counters.Peak        = State.Peak.load(std::memory_order_relaxed);
+        Counters.Reserved    = State.Reserved.load(std::memory_order_relaxed);
+        Counters.Allocations = State.Allocations.load(std::memory_order_relaxed);
+        return Counters;
+    }
+}
@@ -0,0 +1,67 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// \brief Serves every ImGui allocation, keeping small blocks in size-class pools and accounting for all of them.
+    ///
+    /// ImGui's allocator functions are global, so a single allocator serves every context of the process and is safe
+    /// to use from several threads. Small blocks are carved from chunks and recycled through a free list per size
+    /// class, which keeps the many short lived vectors of a frame off the global heap; larger blocks are forwarded to
+    /// it. Chunks are only returned to the heap by \ref Trim, once every block carved from them is free.
+    class ImGuiAllocator final
+    {
+    public:
+
+        /// \brief Counters describing the memory held by ImGui.
+        struct Statistics
+        {
+            /// Number of bytes currently allocated by ImGui.
+            UInt64 Live        = 0;
+
+            /// Highest number of bytes allocated by ImGui at once.
+            UInt64 Peak        = 0;
+
+            /// Number of bytes reserved from the heap, including free pooled blocks.
+            UInt64 Reserved    = 0;
+
+            /// Number of allocations served so far.
+            UInt64 Allocations = 0;
+        };
+
+    public:
+
+        /// Routes ImGui's allocations through the allocator.
+        ///
+        /// Should be called before the first ImGui context is created. Blocks allocated earlier are recognized when
+        /// freed, by the bookkeeping the heap keeps before them, and handed back to the allocator functions that were
+        /// installed before. Later calls have no effect.
+        static void Install();
+
+        /// Returns the chunks whose blocks are all free to the heap, without allocating.
+        static void Trim();
+
+        /// Retrieves the counters of the allocator.
+        ///
+        /// \return The statistics of every allocation made by ImGui so far.
+        static Statistics GetStatistics();
+    };
+}
@@ -0,0 +1,594 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "ImGuiCapture.hpp"
+#include <imgui_internal.h>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    using namespace ImGuiCaptureFormat;
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ImGuiCapture::~ImGuiCapture()
+    {
+        Close();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiCapture::Open(Text Path)
+    {
+        Close();
+
+        mFile = std::fopen(Str(Path).c_str(), "wb");
+
+        if (mFile == nullptr)
+        {
+            return false;
+        }
+
+        const Header Preamble { kMagic, kVersion, sizeof(ImDrawVert), sizeof(ImDrawIdx) };
+        std::fwrite(AddressOf(Preamble), sizeof(Preamble), 1, mFile);
+
+        // Textures created before the capture started must be recorded with the first frame.
+        Reset();
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiCapture::Close()
+    {
+        if (mFile)
+        {
+            std::fclose(mFile);
+            mFile = nullptr;
+        }
+        mBuffer = Vector<Byte>();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiCapture::Write(ConstRef<ImDrawData> Commands)
+    {
+        if (mFile)
+        {
+            // Build the whole frame in memory, so it reaches the file with a single write.
+            const ConstSpan<Byte> Data = Encode(Commands);
+            std::fwrite(Data.data(), 1, Data.size(), mFile);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ConstSpan<Byte> ImGuiCapture::Encode(ConstRef<ImDrawData> Commands)
+    {
+        mBuffer.clear();
+
+        const UInt32 Offset = Reserve(sizeof(Frame));
+        UInt32       Textures = 0;
+
+        if (Commands.Textures != nullptr)
+        {
+            for (const ConstPtr<ImTextureData> Texture : * Commands.Textures)
+            {
+                const auto Width  = static_cast<UInt16>(Texture->Width);
+                const auto Height = static_cast<UInt16>(Texture->Height);
+                const ImTextureRect Full { 0, 0, Width, Height };
+
+                switch (Texture->Status)
+                {
+                case ImTextureStatus_OK:
+                    if (mFresh && Texture->Pixels)
+                    {
+                        Append(* Texture, ImTextureStatus_WantCreate, Full);
+                        ++Textures;
+                    }
+                    break;
+                case ImTextureStatus_WantCreate:
+                    Append(* Texture, ImTextureStatus_WantCreate, Full);
+                    ++Textures;
+                    break;
+                case ImTextureStatus_WantUpdates:
+                    Append(* Texture, mFresh ? ImTextureStatus_WantCreate : ImTextureStatus_WantUpdates,
+                           mFresh ? Full : Texture->UpdateRect);
+                    ++Textures;
+                    break;
+                case ImTextureStatus_WantDestroy:
+                    if (!mFresh)
+                    {
+                        Append(* Texture, ImTextureStatus_WantDestroy, ImTextureRect { 0, 0, 0, 0 });
+                        ++Textures;
+                    }
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+        mFresh = false;
+
+        for (const ConstPtr<ImDrawList> CommandList : Commands.CmdLists)
+        {
+            // User callbacks point into the running program, so they are left out of the capture.
+            UInt32 Count = 0;
+
+            for (ConstRef<ImDrawCmd> Command : CommandList->CmdBuffer)
+            {
+                Count += (Command.UserCallback == nullptr);
+            }
+
+            const UInt32 Vertices = CommandList->VtxBuffer.Size;
+            const UInt32 Indices  = CommandList->IdxBuffer.Size;
+
+            const List Record { Count, Vertices, Indices, 0 };
+            std::memcpy(AddressOf(mBuffer[Reserve(sizeof(List))]), AddressOf(Record), sizeof(Record));
+
+            for (ConstRef<ImDrawCmd> Command : CommandList->CmdBuffer)
+            {
+                if (Command.UserCallback)
+                {
+                    continue;
+                }
+
+                const ConstPtr<ImTextureData> Texture = Command.TexRef._TexData;
+
+                const ImGuiCaptureFormat::Command Entry {
+                    .ClipRect  = { Command.ClipRect.x, Command.ClipRect.y, Command.ClipRect.z, Command.ClipRect.w },
+                    .TexID     = static_cast<UInt64>(Command.TexRef._TexID),
+                    .Texture   = Texture ? Texture->UniqueID : -1,
+                    .VtxOffset = Command.VtxOffset,
+                    .IdxOffset = Command.IdxOffset,
+                    .ElemCount = Command.ElemCount,
+                };
+                std::memcpy(AddressOf(mBuffer[Reserve(sizeof(Entry))]), AddressOf(Entry), sizeof(Entry));
+            }
+
+            if (Vertices > 0)
+            {
+                const UInt32 Size = Vertices * sizeof(ImDrawVert);
+                std::memcpy(AddressOf(mBuffer[Reserve(Size)]), CommandList->VtxBuffer.Data, Size);
+            }
+
+            if (Indices > 0)
+            {
+                const UInt32 Size = Indices * sizeof(ImDrawIdx);
+                std::memcpy(AddressOf(mBuffer[Reserve(Size)]), CommandList->IdxBuffer.Data, Size);
+            }
+        }
+
+        const Frame Record {
+            .Size             = static_cast<UInt32>(mBuffer.size()),
+            .Textures         = Textures,
+            .Lists            = static_cast<UInt32>(Commands.CmdLists.Size),
+            .Reserved         = 0,
+            .DisplayPos       = { Commands.DisplayPos.x, Commands.DisplayPos.y },
+            .DisplaySize      = { Commands.DisplaySize.x, Commands.DisplaySize.y },
+            .FramebufferScale = { Commands.FramebufferScale.x, Commands.FramebufferScale.y },
+        };
+        std::memcpy(AddressOf(mBuffer[Offset]), AddressOf(Record), sizeof(Record));
+
+        return ConstSpan<Byte>(mBuffer.data(), mBuffer.size());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiCapture::Append(ConstRef<ImTextureData> Texture, ImTextureStatus Status, ImTextureRect Rect)
+    {
+        const UInt32 Pitch = Rect.w * Texture.BytesPerPixel;
+
+        const ImGuiCaptureFormat::Texture Record {
+            .UniqueID = Texture.UniqueID,
+            .Status   = static_cast<UInt32>(Status),
+            .Format   = static_cast<UInt32>(Texture.Format),
+            .Width    = static_cast<UInt32>(Texture.Width),
+            .Height   = static_cast<UInt32>(Texture.Height),
+            .Size     = Pitch * Rect.h,
+            .Rect     = { Rect.x, Rect.y, Rect.w, Rect.h },
+        };
+        std::memcpy(AddressOf(mBuffer[Reserve(sizeof(Record))]), AddressOf(Record), sizeof(Record));
+
+        if (Record.Size > 0)
+        {
+            const UInt32 Offset = Reserve(Record.Size);
+
+            for (UInt32 Row = 0; Row < Rect.h; ++Row)
+            {
+                const ConstPtr<Byte> Source = static_cast<ConstPtr<Byte>>(
+                    const_cast<Ref<ImTextureData>>(Texture).GetPixelsAt(Rect.x, Rect.y + Row));
+                std::memcpy(AddressOf(mBuffer[Offset + Row * Pitch]), Source, Pitch);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 ImGuiCapture::Reserve(UInt32 Size)
+    {
+        const UInt32 Offset = static_cast<UInt32>(mBuffer.size());
+        mBuffer.resize(Offset + Align<UInt32>(Size, kAlign), 0);
+        return Offset;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiReplay::Load(Text Path)
+    {
+        const Ptr<std::FILE> File = std::fopen(Str(Path).c_str(), "rb");
+
+        if (File == nullptr)
+        {
+            return false;
+        }
+
+        std::fseek(File, 0, SEEK_END);
+        mStorage.resize(static_cast<UInt32>(std::ftell(File)));
+        std::fseek(File, 0, SEEK_SET);
+
+        const Bool Complete = std::fread(mStorage.data(), 1, mStorage.size(), File) == mStorage.size();
+        std::fclose(File);
+
+        return Complete && Open(ConstSpan<Byte>(mStorage.data(), mStorage.size()));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiReplay::Open(ConstSpan<Byte> Data)
+    {
+        if (Data.size() < sizeof(Header))
+        {
+            return false;
+        }
+
+        // Captures are only replayed by builds sharing the same vertex and index layout.
+        Header Preamble;
+        std::memcpy(AddressOf(Preamble), Data.data(), sizeof(Preamble));
+
+        if (Preamble.Magic != kMagic || Preamble.Version != kVersion
+            || Preamble.VertexSize != sizeof(ImDrawVert) || Preamble.IndexSize != sizeof(ImDrawIdx))
+        {
+            return false;
+        }
+
+        mData = Data;
+        Rewind();
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiReplay::Submit(Ref<ImGuiRenderer> Renderer)
+    {
+        if (mOffset + sizeof(Frame) > mData.size())
+        {
+            return false;
+        }
+
+        const ConstSpan<Byte> Data(mData.data() + mOffset, mData.size() - mOffset);
+
+        if (!Decode(Data))
+        {
+            return false;
+        }
+        mOffset += reinterpret_cast<ConstPtr<Frame>>(Data.data())->Size;
+
+        Present(Renderer);
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiReplay::Decode(ConstSpan<Byte> Data)
+    {
+        if (Data.size() < sizeof(Frame))
+        {
+            return false;
+        }
+
+        ConstPtr<Byte>        Cursor = Data.data();
+        const ConstPtr<Frame> Record = Fetch<Frame>(Cursor, Data.data() + Data.size());
+
+        if (Record->Size < sizeof(Frame) || Record->Size > Data.size())
+        {
+            return false;
+        }
+
+        // Captures may come from damaged files or the network, so no record may reach past the end of its frame.
+        const ConstPtr<Byte> End = Data.data() + Record->Size;
+
+        if (!ReadTextures(Cursor, End, Record->Textures)
+            || Record->Lists > static_cast<UInt32>(End - Cursor) / sizeof(ImGuiCaptureFormat::List))
+        {
+            mFrame.Clear();
+            return false;
+        }
+
+        while (mLists.size() < Record->Lists)
+        {
+            mLists.push_back(IM_NEW(ImDrawList)(nullptr));
+        }
+
+        mFrame.Clear();
+        mFrame.Valid            = true;
+        mFrame.DisplayPos       = ImVec2(Record->DisplayPos[0], Record->DisplayPos[1]);
+        mFrame.DisplaySize      = ImVec2(Record->DisplaySize[0], Record->DisplaySize[1]);
+        mFrame.FramebufferScale = ImVec2(Record->FramebufferScale[0], Record->FramebufferScale[1]);
+        mFrame.Textures         = AddressOf(mPending);
+
+        for (UInt32 Index = 0; Index < Record->Lists; ++Index)
+        {
+            const Ptr<ImDrawList> List = mLists[Index];
+
+            if (!ReadList(Cursor, End, * List))
+            {
+                mFrame.Clear();
+                return false;
+            }
+
+            mFrame.CmdLists.push_back(List);
+            mFrame.CmdListsCount += 1;
+            mFrame.TotalVtxCount += List->VtxBuffer.Size;
+            mFrame.TotalIdxCount += List->IdxBuffer.Size;
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiReplay::Present(Ref<ImGuiRenderer> Renderer)
+    {
+        Renderer.Submit(mFrame);
+
+        Collect();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiReplay::Rewind()
+    {
+        mOffset = sizeof(Header);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiReplay::Close(Ref<ImGuiRenderer> Renderer)
+    {
+        // Submit an empty frame destroying every replayed texture.
+        if (!mTextures.empty())
+        {
+            for (const auto [Identifier, Texture] : mTextures)
+            {
+                Texture->SetStatus(ImTextureStatus_WantDestroy);
+            }
+
+            mFrame.Clear();
+            mFrame.Textures = AddressOf(mPending);
+            Renderer.Submit(mFrame);
+
+            Collect();
+        }
+
+        for (const Ptr<ImDrawList> List : mLists)
+        {
+            IM_DELETE(List);
+        }
+        mLists.clear();
+        mFrame.Clear();
+
+        mStorage = Vector<Byte>();
+        mData    = ConstSpan<Byte>();
+        mOffset  = 0;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiReplay::ReadTextures(Ref<ConstPtr<Byte>> Cursor, ConstPtr<Byte> End, UInt32 Count)
+    {
+        for (UInt32 Index = 0; Index < Count; ++Index)
+        {
+            const ConstPtr<Texture> Record = Fetch<Texture>(Cursor, End);
+            const ConstPtr<Byte>    Pixels = Record ? Fetch<Byte>(Cursor, End, Record->Size) : nullptr;
+
+            if (Pixels == nullptr)
+            {
+                return false;
+            }
+
+            // Pixels are copied into the texture row by row, so the rectangle must lie within the texture and the
+            // record must hold exactly its pixels.
+            const auto [X, Y, W, H] = Record->Rect;
+
+            const Bool   Alpha = Record->Format == ImTextureFormat_Alpha8;
+            const UInt32 Pitch = W * (Alpha ? 1 : 4);
+
+            if ((!Alpha && Record->Format != ImTextureFormat_RGBA32)
+                || Record->Width  == 0 || Record->Width  > kExtent || X + W > Record->Width
+                || Record->Height == 0 || Record->Height > kExtent || Y + H > Record->Height
+                || Record->Size != Pitch * H)
+            {
+                return false;
+            }
+
+            Ptr<ImTextureData> & Texture = mTextures[Record->UniqueID];
+
+            if (Texture == nullptr)
+            {
+                if (Record->Status != ImTextureStatus_WantCreate)
+                {
+                    mTextures.erase(Record->UniqueID);
+                    continue;
+                }
+
+                Texture = IM_NEW(ImTextureData)();
+                Texture->UniqueID = Record->UniqueID + kUniqueOffset;
+                mPending.push_back(Texture);
+            }
+            else if (Texture->Status != ImTextureStatus_Destroyed && (Texture->Format != Record->Format
+                || static_cast<UInt32>(Texture->Width) != Record->Width
+                || static_cast<UInt32>(Texture->Height) != Record->Height))
+            {
+                return false;
+            }
+
+            switch (Record->Status)
+            {
+            case ImTextureStatus_WantCreate:
+                if (Texture->Status == ImTextureStatus_Destroyed)
+                {
+                    Texture->Create(static_cast<ImTextureFormat>(Record->Format), Record->Width, Record->Height);
+                    break;
+                }
+
+                // The texture is still alive after a rewind, so its whole contents are uploaded again instead.
+                [[fallthrough]];
+            case ImTextureStatus_WantUpdates:
+                // Updates pile up while the renderer skips frames, and a pending creation uploads them anyway.
+                if (Texture->Status == ImTextureStatus_OK)
+                {
+                    Texture->Updates.clear();
+                    Texture->SetStatus(ImTextureStatus_WantUpdates);
+                }
+
+                if (Texture->Status == ImTextureStatus_WantUpdates)
+                {
+                    Texture->Updates.push_back(ImTextureRect { X, Y, W, H });
+                }
+                break;
+            case ImTextureStatus_WantDestroy:
+                Texture->SetStatus(ImTextureStatus_WantDestroy);
+                continue;
+            default:
+                continue;
+            }
+
+            for (UInt32 Row = 0; Row < H; ++Row)
+            {
+                std::memcpy(Texture->GetPixelsAt(X, Y + Row), Pixels + Row * Pitch, Pitch);
+            }
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiReplay::ReadList(Ref<ConstPtr<Byte>> Cursor, ConstPtr<Byte> End, Ref<ImDrawList> List)
+    {
+        const ConstPtr<ImGuiCaptureFormat::List> Record = Fetch<ImGuiCaptureFormat::List>(Cursor, End);
+
+        if (Record == nullptr)
+        {
+            return false;
+        }
+
+        const ConstPtr<Command>    Commands = Fetch<Command>(Cursor, End, Record->Commands);
+        const ConstPtr<ImDrawVert> Vertices = Commands ? Fetch<ImDrawVert>(Cursor, End, Record->Vertices) : nullptr;
+        const ConstPtr<ImDrawIdx>  Indices  = Vertices ? Fetch<ImDrawIdx>(Cursor, End, Record->Indices) : nullptr;
+
+        if (Indices == nullptr)
+        {
+            return false;
+        }
+
+        // The renderer reads every index range and every vertex it references, so all of them must lie in the list.
+        for (UInt32 Index = 0; Index < Record->Commands; ++Index)
+        {
+            ConstRef<Command> Source = Commands[Index];
+
+            if (Source.IdxOffset > Record->Indices || Source.ElemCount > Record->Indices - Source.IdxOffset
+                || Source.VtxOffset > Record->Vertices)
+            {
+                return false;
+            }
+
+            const UInt32 Limit = Record->Vertices - Source.VtxOffset;
+
+            for (UInt32 Element = 0; Element < Source.ElemCount; ++Element)
+            {
+                if (Indices[Source.IdxOffset + Element] >= Limit)
+                {
+                    return false;
+                }
+            }
+        }
+
+        List.CmdBuffer.resize(Record->Commands);
+
+        for (UInt32 Index = 0; Index < Record->Commands; ++Index)
+        {
+            ConstRef<Command> Source  = Commands[Index];
+            Ref<ImDrawCmd>    Command = List.CmdBuffer[Index] = ImDrawCmd();
+
+            Command.ClipRect  = ImVec4(Source.ClipRect[0], Source.ClipRect[1], Source.ClipRect[2], Source.ClipRect[3]);
+            Command.VtxOffset = Source.VtxOffset;
+            Command.IdxOffset = Source.IdxOffset;
+            Command.ElemCount = Source.ElemCount;
+
+            if (const auto Iterator = mTextures.find(Source.Texture); Iterator != mTextures.end())
+            {
+                Command.TexRef._TexData = Iterator->second;
+            }
+            else
+            {
+                Command.TexRef = ImTextureRef(static_cast<ImTextureID>(Source.TexID));
+            }
+        }
+
+        List.VtxBuffer.resize(Record->Vertices);
+        std::memcpy(List.VtxBuffer.Data, Vertices, Record->Vertices * sizeof(ImDrawVert));
+
+        List.IdxBuffer.resize(Record->Indices);
+        std::memcpy(List.IdxBuffer.Data, Indices, Record->Indices * sizeof(ImDrawIdx));
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiReplay::Collect()
+    {
+        for (auto Iterator = mTextures.begin(); Iterator != mTextures.end();)
+        {
+            if (const Ptr<ImTextureData> Texture = Iterator->second; Texture->Status == ImTextureStatus_Destroyed)
+            {
+                mPending.erase(std::find(mPending.begin(), mPending.end(), Texture));
+                IM_DELETE(Texture);
+
+                Iterator = mTextures.erase(Iterator);
+            }
+            else
+            {
+                ++Iterator;
+            }
+        }
+    }
+}
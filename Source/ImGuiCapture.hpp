@@ -0,0 +1,333 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "ImGuiRenderer.hpp"
+#include <cstdio>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// \brief Binary layout of captured ImGui frames.
+    ///
+    /// A capture is a file header followed by frames stored back to back. Every record is 8-byte aligned and holds
+    /// plain data, so a capture can be memory-mapped and walked in place:
+    ///
+    /// - Frame: \ref Frame, then its textures, then its draw lists.
+    /// - Texture: \ref Texture, then the pixels of its created or updated rectangle padded to 8 bytes.
+    /// - Draw list: \ref List, then its commands, then its vertices and its indices, each padded to 8 bytes.
+    namespace ImGuiCaptureFormat
+    {
+        /// Value identifying a capture file.
+        static constexpr UInt32 kMagic   = 0x4347495A;
+
+        /// Version of the layout described here.
+        static constexpr UInt32 kVersion = 1;
+
+        /// Alignment of every record.
+        static constexpr UInt32 kAlign   = 8;
+
+        /// Largest width or height of a texture, which bounds the memory a damaged capture can request.
+        static constexpr UInt32 kExtent  = 16384;
+
+        /// \brief Header at the start of a capture file.
+        struct Header
+        {
+            /// Value identifying the file, see \ref kMagic.
+            UInt32 Magic;
+
+            /// Version of the layout, see \ref kVersion.
+            UInt32 Version;
+
+            /// Size in bytes of a vertex.
+            UInt32 VertexSize;
+
+            /// Size in bytes of an index.
+            UInt32 IndexSize;
+        };
+
+        /// \brief Header of a captured frame.
+        struct Frame
+        {
+            /// Size in bytes of the frame, including this header.
+            UInt32 Size;
+
+            /// Number of texture records in the frame.
+            UInt32 Textures;
+
+            /// Number of draw list records in the frame.
+            UInt32 Lists;
+
+            /// Reserved for alignment.
+            UInt32 Reserved;
+
+            /// Position of the display's top-left corner.
+            Real32 DisplayPos[2];
+
+            /// Size of the display.
+            Real32 DisplaySize[2];
+
+            /// Scale of the framebuffer relative to the display.
+            Real32 FramebufferScale[2];
+        };
+
+        /// \brief Texture operation requested by a captured frame.
+        struct Texture
+        {
+            /// Unique identifier of the texture.
+            SInt32 UniqueID;
+
+            /// Requested status, one of \c ImTextureStatus.
+            UInt32 Status;
+
+            /// Pixel format, one of \c ImTextureFormat.
+            UInt32 Format;
+
+            /// Width of the texture in pixels.
+            UInt32 Width;
+
+            /// Height of the texture in pixels.
+            UInt32 Height;
+
+            /// Size in bytes of the pixels following this record, or zero when none are needed.
+            UInt32 Size;
+
+            /// Rectangle covered by the pixels (X, Y, width and height), tightly packed row after row.
+            UInt16 Rect[4];
+        };
+
+        /// \brief Header of a captured draw list.
+        struct List
+        {
+            /// Number of command records following this header.
+            UInt32 Commands;
+
+            /// Number of vertices following the commands.
+            UInt32 Vertices;
+
+            /// Number of indices following the vertices.
+            UInt32 Indices;
+
+            /// Reserved for alignment.
+            UInt32 Reserved;
+        };
+
+        /// \brief Captured draw command.
+        struct Command
+        {
+            /// Clipping rectangle, in display coordinates.
+            Real32 ClipRect[4];
+
+            /// Identifier of a user texture, used when \ref Texture is negative.
+            UInt64 TexID;
+
+            /// Unique identifier of the texture sampled by the command, or `-1` for user textures.
+            SInt32 Texture;
+
+            /// Offset of the command's first vertex within the draw list.
+            UInt32 VtxOffset;
+
+            /// Offset of the command's first index within the draw list.
+            UInt32 IdxOffset;
+
+            /// Number of indices drawn by the command.
+            UInt32 ElemCount;
+        };
+
+        /// Reads records in place and advances past them, including their padding.
+        ///
+        /// \param Cursor The position of the first record, advanced past the last one.
+        /// \param End    The end of the data holding the records.
+        /// \param Count  The number of consecutive records to read.
+        /// \return The first record, or `nullptr` if the records run past the end of the data.
+        template<typename Type>
+        inline ConstPtr<Type> Fetch(Ref<ConstPtr<Byte>> Cursor, ConstPtr<Byte> End, UInt32 Count = 1)
+        {
+            const UInt64 Size = Align<UInt64>(static_cast<UInt64>(sizeof(Type)) * Count, kAlign);
+
+            if (Cursor > End || Size > static_cast<UInt64>(End - Cursor))
+            {
+                return nullptr;
+            }
+
+            const ConstPtr<Type> Record = reinterpret_cast<ConstPtr<Type>>(Cursor);
+            Cursor += Size;
+            return Record;
+        }
+    }
+
+    /// \brief Streams ImGui frames to a capture file, see \ref ImGuiCaptureFormat.
+    ///
+    /// Frames must be captured before they are submitted, since submitting consumes their texture operations.
+    /// User callbacks cannot be captured and are left out.
+    class ImGuiCapture final
+    {
+    public:
+
+        /// Ensures the capture file is closed.
+        ~ImGuiCapture();
+
+        /// Creates a capture file, closing the previous one.
+        ///
+        /// \param Path The path of the file to create.
+        /// \return `true` if the file was created, `false` otherwise.
+        Bool Open(Text Path);
+
+        /// Flushes and closes the capture file.
+        void Close();
+
+        /// Appends a frame to the capture file.
+        ///
+        /// \param Commands The ImGui draw data to capture.
+        void Write(ConstRef<ImDrawData> Commands);
+
+        /// Serializes a frame without writing it anywhere.
+        ///
+        /// \param Commands The ImGui draw data to serialize.
+        /// \return The serialized frame, valid until the next frame is serialized.
+        ConstSpan<Byte> Encode(ConstRef<ImDrawData> Commands);
+
+        /// Records every live texture with the next frame, for readers starting from that frame.
+        void Reset()
+        {
+            mFresh = true;
+        }
+
+        /// Checks whether frames are being captured.
+        ///
+        /// \return `true` if a capture file is open, `false` otherwise.
+        Bool IsOpen() const
+        {
+            return mFile != nullptr;
+        }
+
+    private:
+
+        /// Appends a texture record, with the pixels of the given rectangle, to the frame being built.
+        ///
+        /// \param Texture The texture to record.
+        /// \param Status  The status to record the texture with.
+        /// \param Rect    The rectangle whose pixels are recorded, empty when none are needed.
+        void Append(ConstRef<ImTextureData> Texture, ImTextureStatus Status, ImTextureRect Rect);
+
+        /// Grows the frame being built by a record, padded to the record alignment.
+        ///
+        /// \param Size The size in bytes of the record.
+        /// \return The offset of the record within the frame.
+        UInt32 Reserve(UInt32 Size);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Ptr<std::FILE> mFile  = nullptr;
+        Bool           mFresh = false;
+        Vector<Byte>   mBuffer;
+    };
+
+    /// \brief Feeds frames read from a capture back through a renderer, without running any UI code.
+    class ImGuiReplay final
+    {
+    public:
+
+        /// Offset added to captured texture identifiers, so they never collide with live textures of the renderer.
+        static constexpr SInt32 kUniqueOffset = 1 << 30;
+
+    public:
+
+        /// Reads a whole capture file into memory and opens it.
+        ///
+        /// \param Path The path of the capture file.
+        /// \return `true` if the file holds a valid capture, `false` otherwise.
+        Bool Load(Text Path);
+
+        /// Opens a capture held in memory (e.g. a memory-mapped file), which must outlive the replay.
+        ///
+        /// \param Data The contents of the capture.
+        /// \return `true` if the data holds a valid capture, `false` otherwise.
+        Bool Open(ConstSpan<Byte> Data);
+
+        /// Submits the next captured frame.
+        ///
+        /// \param Renderer The renderer the frame is submitted to.
+        /// \return `true` if a frame was submitted, `false` once every frame has been replayed.
+        Bool Submit(Ref<ImGuiRenderer> Renderer);
+
+        /// Reads a single frame, e.g. one received from a remote UI, and makes it the frame presented next.
+        ///
+        /// Texture operations of frames read without being presented are accumulated until the next presentation.
+        ///
+        /// \param Data The contents of the frame.
+        /// \return `true` if the frame was read, `false` if it is malformed.
+        Bool Decode(ConstSpan<Byte> Data);
+
+        /// Submits the last frame read.
+        ///
+        /// \param Renderer The renderer the frame is submitted to.
+        void Present(Ref<ImGuiRenderer> Renderer);
+
+        /// Checks whether a frame has been read.
+        ///
+        /// \return `true` if there is a frame to present, `false` otherwise.
+        Bool HasFrame() const
+        {
+            return mFrame.Valid;
+        }
+
+        /// Restarts the replay from the first frame.
+        void Rewind();
+
+        /// Destroys the replayed textures on the renderer and releases every resource of the replay.
+        ///
+        /// \param Renderer The renderer the frames were submitted to.
+        void Close(Ref<ImGuiRenderer> Renderer);
+
+    private:
+
+        /// Applies the texture operations of a captured frame to the replayed textures.
+        ///
+        /// \param Cursor The position of the frame's first texture record, advanced past the last one.
+        /// \param End    The end of the frame.
+        /// \param Count  The number of texture records.
+        /// \return `true` if every record was applied, `false` if a record is malformed.
+        Bool ReadTextures(Ref<ConstPtr<Byte>> Cursor, ConstPtr<Byte> End, UInt32 Count);
+
+        /// Rebuilds a draw list from its captured record.
+        ///
+        /// \param Cursor The position of the draw list record, advanced past its indices.
+        /// \param End    The end of the frame.
+        /// \param List   The draw list to fill.
+        /// \return `true` if the draw list was rebuilt, `false` if its record is malformed.
+        Bool ReadList(Ref<ConstPtr<Byte>> Cursor, ConstPtr<Byte> End, Ref<ImDrawList> List);
+
+        /// Releases the replayed textures whose destruction was handled by the renderer.
+        void Collect();
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Byte>                      mStorage;
+        ConstSpan<Byte>                   mData;
+        UInt32                            mOffset = 0;
+        ImDrawData                        mFrame;
+        Vector<Ptr<ImDrawList>>           mLists;
+        Table<SInt32, Ptr<ImTextureData>> mTextures;
+        ImVector<ImTextureData *>         mPending;
+    };
+}
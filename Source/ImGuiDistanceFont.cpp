@@ -0,0 +1,234 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "ImGuiDistanceFont.hpp"
+#include "ImGuiFontCache.hpp"
+#include <imgui_internal.h>
+
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <imstb_truetype.h>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// \brief Per source data kept by the distance field font loader.
+    struct ImGuiDistanceFontSource
+    {
+        /// The parsed font file.
+        stbtt_fontinfo Info;
+
+        /// Scale converting font units to pixels for a size of one.
+        Real32         Scale;
+
+        /// Baked glyphs, persisted between runs when a cache directory is set.
+        ImGuiFontCache Cache;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool OnFontSrcInit(Ptr<ImFontAtlas> Atlas, Ptr<ImFontConfig> Source)
+    {
+        const ConstPtr<UInt8> Data = static_cast<ConstPtr<UInt8>>(Source->FontData);
+
+        const Ptr<ImGuiDistanceFontSource> Font = IM_NEW(ImGuiDistanceFontSource)();
+
+        if (!stbtt_InitFont(AddressOf(Font->Info), Data, stbtt_GetFontOffsetForIndex(Data, Source->FontNo)))
+        {
+            IM_DELETE(Font);
+            return false;
+        }
+
+        // Negative sizes are expressed in em units rather than pixel height, same as the default loader.
+        Font->Scale = Source->SizePixels >= 0.0f
+            ? stbtt_ScaleForPixelHeight(AddressOf(Font->Info), 1.0f)
+            : stbtt_ScaleForMappingEmToPixels(AddressOf(Font->Info), 1.0f);
+
+        Font->Cache.Open(Source, ImGuiDistanceFont::GetLoader()->Name);
+
+        Source->FontLoaderData = Font;
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void OnFontSrcDestroy(Ptr<ImFontAtlas> Atlas, Ptr<ImFontConfig> Source)
+    {
+        const Ptr<ImGuiDistanceFontSource> Font = static_cast<Ptr<ImGuiDistanceFontSource>>(Source->FontLoaderData);
+
+        Font->Cache.Close();
+        IM_DELETE(Font);
+
+        Source->FontLoaderData = nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool OnFontSrcContainsGlyph(Ptr<ImFontAtlas> Atlas, Ptr<ImFontConfig> Source, ImWchar Codepoint)
+    {
+        const ConstPtr<ImGuiDistanceFontSource> Font = static_cast<ConstPtr<ImGuiDistanceFontSource>>(Source->FontLoaderData);
+
+        return stbtt_FindGlyphIndex(AddressOf(Font->Info), Codepoint) != 0;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool OnFontBakedInit(Ptr<ImFontAtlas> Atlas, Ptr<ImFontConfig> Source, Ptr<ImFontBaked> Baked, Ptr<void> Data)
+    {
+        const ConstPtr<ImGuiDistanceFontSource> Font = static_cast<ConstPtr<ImGuiDistanceFontSource>>(Source->FontLoaderData);
+
+        if (Source->MergeMode == false)
+        {
+            SInt32 Ascent, Descent, LineGap;
+            stbtt_GetFontVMetrics(AddressOf(Font->Info), AddressOf(Ascent), AddressOf(Descent), AddressOf(LineGap));
+
+            const Real32 Scale = Font->Scale * Baked->Size;
+            Baked->Ascent  = ImCeil(Ascent * Scale);
+            Baked->Descent = ImFloor(Descent * Scale);
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool OnFontBakedLoadGlyph(Ptr<ImFontAtlas> Atlas, Ptr<ImFontConfig> Source, Ptr<ImFontBaked> Baked, Ptr<void> Data,
+        ImWchar Codepoint, Ptr<ImFontGlyph> Glyph, Ptr<Real32> Advance)
+    {
+        const Ptr<ImGuiDistanceFontSource> Font = static_cast<Ptr<ImGuiDistanceFontSource>>(Source->FontLoaderData);
+
+        const SInt32 Index = stbtt_FindGlyphIndex(AddressOf(Font->Info), Codepoint);
+
+        if (Index == 0)
+        {
+            return false;
+        }
+
+        const Real32 Scale = Font->Scale * Baked->Size;
+
+        SInt32 Width, Bearing;
+        stbtt_GetGlyphHMetrics(AddressOf(Font->Info), Index, AddressOf(Width), AddressOf(Bearing));
+
+        // Metrics only request.
+        if (Advance)
+        {
+            * Advance = Width * Scale;
+            return true;
+        }
+
+        Glyph->Codepoint = Codepoint;
+        Glyph->AdvanceX  = Width * Scale;
+
+        // Distance fields are independent of the size they are displayed at, so the glyph is baked without oversampling.
+        const UInt64 Hash  = ImGuiFontCache::GetHash(Codepoint, Source, Baked);
+        auto         Entry = Font->Cache.Find(Hash);
+
+        if (Entry == nullptr)
+        {
+            const Real32 Raster = Scale * Source->RasterizerDensity * Baked->RasterizerDensity;
+
+            SInt32 W = 0, H = 0, X = 0, Y = 0;
+            const Ptr<UInt8> Field = stbtt_GetGlyphSDF(
+                AddressOf(Font->Info),
+                Raster,
+                Index,
+                ImGuiDistanceFont::kPadding,
+                ImGuiDistanceFont::kEdgeValue,
+                ImGuiDistanceFont::kDistanceScale,
+                AddressOf(W),
+                AddressOf(H),
+                AddressOf(X),
+                AddressOf(Y));
+
+            // Empty glyphs are cached as well, with no pixels, so they are never looked up again.
+            if (Field == nullptr)
+            {
+                W = H = 0;
+            }
+
+            const Real32 Density = 1.0f / (Source->RasterizerDensity * Baked->RasterizerDensity);
+            const Real32 OffsetX = Source->GlyphOffset.x;
+            const Real32 OffsetY = Source->GlyphOffset.y + IM_ROUND(Baked->Ascent);
+
+            const ImGuiFontCache::Glyph Baking {
+                X * Density + OffsetX,
+                Y * Density + OffsetY,
+                (X + W) * Density + OffsetX,
+                (Y + H) * Density + OffsetY,
+                Glyph->AdvanceX,
+                static_cast<UInt32>(W),
+                static_cast<UInt32>(H),
+                0
+            };
+            std::copy(Field, Field + W * H, Font->Cache.Insert(Hash, Baking));
+
+            stbtt_FreeSDF(Field, nullptr);
+
+            Entry = Font->Cache.Find(Hash);
+        }
+
+        const SInt32 W = Entry->Width;
+        const SInt32 H = Entry->Height;
+
+        if (W == 0 || H == 0)
+        {
+            return true;
+        }
+
+        const ImFontAtlasRectId Pack = ImFontAtlasPackAddRect(Atlas, W, H);
+
+        if (Pack == ImFontAtlasRectId_Invalid)
+        {
+            IM_ASSERT(Pack != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+            return false;
+        }
+
+        const Ptr<ImTextureRect> Rect   = ImFontAtlasPackGetRect(Atlas, Pack);
+        const ConstPtr<UInt8>    Pixels = Font->Cache.GetPixels(* Entry);
+
+        Glyph->X0      = Entry->X0;
+        Glyph->Y0      = Entry->Y0;
+        Glyph->X1      = Entry->X1;
+        Glyph->Y1      = Entry->Y1;
+        Glyph->Visible = true;
+        Glyph->PackId  = Pack;
+
+        ImFontAtlasBakedSetFontGlyphBitmap(Atlas, Baked, Source, Glyph, Rect, Pixels, ImTextureFormat_Alpha8, W);
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ConstPtr<ImFontLoader> ImGuiDistanceFont::GetLoader()
+    {
+        static const ImFontLoader Loader = []
+        {
+            ImFontLoader Loader;
+            Loader.Name                 = "Zyphryon (Distance Field)";
+            Loader.FontSrcInit          = OnFontSrcInit;
+            Loader.FontSrcDestroy       = OnFontSrcDestroy;
+            Loader.FontSrcContainsGlyph = OnFontSrcContainsGlyph;
+            Loader.FontBakedInit        = OnFontBakedInit;
+            Loader.FontBakedLoadGlyph   = OnFontBakedLoadGlyph;
+            return Loader;
+        }();
+        return AddressOf(Loader);
+    }
+}
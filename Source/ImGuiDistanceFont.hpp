@@ -0,0 +1,54 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <imgui.h>
+#include <Zyphryon.Graphic/Technique.hpp>
+
+struct ImFontLoader;
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// \brief Font loader that bakes glyphs as signed distance fields.
+    ///
+    /// Glyphs are baked once at the font's reference size into a single channel atlas, where every texel stores the
+    /// distance to the glyph outline. Fonts loaded this way lock their baked size, so every other size is rendered by
+    /// scaling the reference glyphs instead of rasterizing them again.
+    ///
+    /// Baked glyphs are kept by an \ref ImGuiFontCache, so later runs copy the distance fields from disk instead of
+    /// computing them again when a cache directory is set.
+    class ImGuiDistanceFont final
+    {
+    public:
+
+        /// Number of texels around each glyph used to encode the distance field.
+        static constexpr SInt32 kPadding       = 4;
+
+        /// Value stored for texels lying exactly on the glyph outline.
+        static constexpr UInt8  kEdgeValue     = 128;
+
+        /// Increment of the stored value per texel of distance to the outline.
+        static constexpr Real32 kDistanceScale = static_cast<Real32>(kEdgeValue) / kPadding;
+
+    public:
+
+        /// Retrieves the font loader that bakes glyphs as signed distance fields.
+        ///
+        /// \return The distance field font loader.
+        static ConstPtr<ImFontLoader> GetLoader();
+    };
+}
@@ -0,0 +1,586 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "ImGuiFontCache.hpp"
+#include <imgui_internal.h>
+#include <cstdio>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// Identifies a glyph cache file.
+    static constexpr UInt32 kCacheMagic   = 0x46445A59;
+
+    /// Layout revision of the glyph cache file, bumped whenever the baking or the file format changes.
+    static constexpr UInt32 kCacheVersion = 2;
+
+    /// Largest glyph bitmap dimension accepted from a cache file.
+    static constexpr UInt32 kCacheExtent  = 4096;
+
+    /// \brief Preamble of a glyph cache file.
+    struct ImGuiFontCacheHeader
+    {
+        UInt32 Magic;
+        UInt32 Version;
+        UInt64 Key;
+        UInt32 Count;
+        UInt32 Reserved;
+    };
+
+    /// \brief Glyph stored in a glyph cache file, followed by its pixels once every record has been written.
+    struct ImGuiFontCacheRecord
+    {
+        UInt64 Hash;
+        Real32 X0;
+        Real32 Y0;
+        Real32 X1;
+        Real32 Y1;
+        Real32 Advance;
+        UInt32 Width;
+        UInt32 Height;
+        UInt32 Reserved;
+    };
+
+    /// \brief Font loader wrapping the loader an atlas had installed with the cache.
+    struct ImGuiFontCacheLoader
+    {
+        /// Hooks handed to the atlas, first so the atlas pointer to them leads back to the wrapper.
+        ImFontLoader           Hooks;
+
+        /// Loader baking the glyphs missing from the cache.
+        ConstPtr<ImFontLoader> Inner;
+    };
+
+    /// \brief Per source data kept by the caching font loader.
+    struct ImGuiFontCacheSource
+    {
+        /// Loader baking the glyphs of the source.
+        ConstPtr<ImFontLoader> Loader;
+
+        /// Per source data of the wrapped loader.
+        Ptr<void>              Inner;
+
+        /// Glyphs baked by the wrapped loader.
+        ImGuiFontCache         Cache;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ref<Str> GetDirectory()
+    {
+        static Str Directory;
+        return Directory;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 GetBits(Real32 Value)
+    {
+        UInt32 Bits;
+        std::memcpy(AddressOf(Bits), AddressOf(Value), sizeof(Bits));
+        return Bits;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ref<Vector<Ptr<ImGuiFontCacheLoader>>> GetLoaders()
+    {
+        // Atlases keep pointers to the wrappers until they are destroyed, so the wrappers are never released.
+        static Vector<Ptr<ImGuiFontCacheLoader>> Loaders;
+        return Loaders;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static ConstPtr<ImGuiFontCacheLoader> GetWrapper(ConstPtr<ImFontLoader> Loader)
+    {
+        for (ConstPtr<ImGuiFontCacheLoader> Wrapper : GetLoaders())
+        {
+            if (AddressOf(Wrapper->Hooks) == Loader)
+            {
+                return Wrapper;
+            }
+        }
+        return nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static ConstPtr<ImFontLoader> GetInner(ConstPtr<ImFontConfig> Source)
+    {
+        return static_cast<ConstPtr<ImGuiFontCacheSource>>(Source->FontLoaderData)->Loader;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    /// \brief Hands the wrapped loader its own per source data for the duration of a call.
+    class ImGuiFontCacheScope final
+    {
+    public:
+
+        explicit ImGuiFontCacheScope(Ptr<ImFontConfig> Source)
+            : mSource { Source },
+              mOuter  { Source->FontLoaderData }
+        {
+            mSource->FontLoaderData = static_cast<Ptr<ImGuiFontCacheSource>>(mOuter)->Inner;
+        }
+
+        ~ImGuiFontCacheScope()
+        {
+            mSource->FontLoaderData = mOuter;
+        }
+
+    private:
+
+        Ptr<ImFontConfig> mSource;
+        Ptr<void>         mOuter;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool OnFontSrcInit(Ptr<ImFontAtlas> Atlas, Ptr<ImFontConfig> Source)
+    {
+        const ConstPtr<ImFontLoader> Outer  = Source->FontLoader ? Source->FontLoader : Atlas->FontLoader;
+        const ConstPtr<ImFontLoader> Loader = GetWrapper(Outer)->Inner;
+
+        if (!Loader->FontSrcInit(Atlas, Source))
+        {
+            return false;
+        }
+
+        const Ptr<ImGuiFontCacheSource> Font = IM_NEW(ImGuiFontCacheSource)();
+        Font->Loader = Loader;
+        Font->Inner  = Source->FontLoaderData;
+
+        // ImGui scales the texels of these sources after they are copied to the atlas, which the cache would repeat.
+        if (Source->RasterizerMultiply == 1.0f)
+        {
+            Font->Cache.Open(Source, Loader->Name);
+        }
+
+        Source->FontLoaderData = Font;
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void OnFontSrcDestroy(Ptr<ImFontAtlas> Atlas, Ptr<ImFontConfig> Source)
+    {
+        const Ptr<ImGuiFontCacheSource> Font   = static_cast<Ptr<ImGuiFontCacheSource>>(Source->FontLoaderData);
+        const ConstPtr<ImFontLoader>    Loader = Font->Loader;
+        Font->Cache.Close();
+
+        Source->FontLoaderData = Font->Inner;
+        IM_DELETE(Font);
+
+        if (Loader->FontSrcDestroy)
+        {
+            Loader->FontSrcDestroy(Atlas, Source);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool OnFontSrcContainsGlyph(Ptr<ImFontAtlas> Atlas, Ptr<ImFontConfig> Source, ImWchar Codepoint)
+    {
+        const ConstPtr<ImFontLoader> Loader = GetInner(Source);
+        const ImGuiFontCacheScope    Scope(Source);
+        return Loader->FontSrcContainsGlyph(Atlas, Source, Codepoint);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool OnFontBakedInit(Ptr<ImFontAtlas> Atlas, Ptr<ImFontConfig> Source, Ptr<ImFontBaked> Baked, Ptr<void> Data)
+    {
+        const ConstPtr<ImFontLoader> Loader = GetInner(Source);
+        const ImGuiFontCacheScope    Scope(Source);
+        return Loader->FontBakedInit(Atlas, Source, Baked, Data);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void OnFontBakedDestroy(Ptr<ImFontAtlas> Atlas, Ptr<ImFontConfig> Source, Ptr<ImFontBaked> Baked, Ptr<void> Data)
+    {
+        const ConstPtr<ImFontLoader> Loader = GetInner(Source);
+        const ImGuiFontCacheScope    Scope(Source);
+        Loader->FontBakedDestroy(Atlas, Source, Baked, Data);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool OnFontBakedLoadGlyph(Ptr<ImFontAtlas> Atlas, Ptr<ImFontConfig> Source, Ptr<ImFontBaked> Baked, Ptr<void> Data,
+        ImWchar Codepoint, Ptr<ImFontGlyph> Glyph, Ptr<Real32> Advance)
+    {
+        const Ptr<ImGuiFontCacheSource> Font = static_cast<Ptr<ImGuiFontCacheSource>>(Source->FontLoaderData);
+        const UInt64                    Hash = ImGuiFontCache::GetHash(Codepoint, Source, Baked);
+
+        // Metrics only requests are cheap, and a miss would have nothing to store.
+        const ConstPtr<ImGuiFontCache::Glyph> Entry = Advance ? nullptr : Font->Cache.Find(Hash);
+
+        if (Entry == nullptr)
+        {
+            Bool Loaded;
+            {
+                const ImGuiFontCacheScope Scope(Source);
+                Loaded = Font->Loader->FontBakedLoadGlyph(Atlas, Source, Baked, Data, Codepoint, Glyph, Advance);
+            }
+
+            if (!Loaded || Advance || !Font->Cache.IsPersistent())
+            {
+                return Loaded;
+            }
+
+            // Read the bitmap back from the atlas, it holds the coverage as rasterized by the wrapped loader.
+            const ConstPtr<ImTextureRect> Rect = Glyph->Visible
+                ? ImFontAtlasPackGetRect(Atlas, Glyph->PackId)
+                : nullptr;
+            const UInt32 W = Rect ? Rect->w : 0;
+            const UInt32 H = Rect ? Rect->h : 0;
+
+            const Ptr<UInt8> Pixels = Font->Cache.Insert(Hash, {
+                Glyph->X0, Glyph->Y0, Glyph->X1, Glyph->Y1, Glyph->AdvanceX, W, H, 0 });
+
+            const Ptr<ImTextureData> Texture = Atlas->TexData;
+
+            for (UInt32 Row = 0; Row < H; ++Row)
+            {
+                const Ptr<void>       Address = Texture->GetPixelsAt(Rect->x, Rect->y + Row);
+                const ConstPtr<UInt8> Texels  = static_cast<ConstPtr<UInt8>>(Address);
+
+                if (Texture->Format == ImTextureFormat_Alpha8)
+                {
+                    std::memcpy(Pixels + Row * W, Texels, W);
+                }
+                else
+                {
+                    for (UInt32 Column = 0; Column < W; ++Column)
+                    {
+                        Pixels[Row * W + Column] = Texels[Column * 4 + 3];
+                    }
+                }
+            }
+            return true;
+        }
+
+        Glyph->Codepoint = Codepoint;
+        Glyph->AdvanceX  = Entry->Advance;
+
+        if (Entry->Width == 0 || Entry->Height == 0)
+        {
+            return true;
+        }
+
+        const SInt32            W    = Entry->Width;
+        const SInt32            H    = Entry->Height;
+        const ImFontAtlasRectId Pack = ImFontAtlasPackAddRect(Atlas, W, H);
+
+        if (Pack == ImFontAtlasRectId_Invalid)
+        {
+            IM_ASSERT(Pack != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+            return false;
+        }
+
+        Glyph->X0      = Entry->X0;
+        Glyph->Y0      = Entry->Y0;
+        Glyph->X1      = Entry->X1;
+        Glyph->Y1      = Entry->Y1;
+        Glyph->Visible = true;
+        Glyph->PackId  = Pack;
+
+        const Ptr<ImTextureRect> Rect = ImFontAtlasPackGetRect(Atlas, Pack);
+        ImFontAtlasBakedSetFontGlyphBitmap(
+            Atlas, Baked, Source, Glyph, Rect, Font->Cache.GetPixels(* Entry), ImTextureFormat_Alpha8, W);
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiFontCache::Apply(Ptr<ImFontAtlas> Atlas)
+    {
+        // The atlas picks ImGui's default loader (FreeType or stb_truetype, as configured) the first time it is used.
+        if (Atlas->FontLoader == nullptr)
+        {
+            ImFontAtlasBuildInit(Atlas);
+        }
+
+        const ConstPtr<ImGuiFontCacheLoader> Current = GetWrapper(Atlas->FontLoader);
+
+        if (GetDirectory().empty())
+        {
+            if (Current)
+            {
+                Atlas->SetFontLoader(Current->Inner);
+            }
+            return;
+        }
+
+        if (Current || Atlas->FontLoader == nullptr)
+        {
+            return;
+        }
+
+        // One wrapper is kept per wrapped loader, so atlases sharing a loader share its wrapper as well.
+        for (ConstPtr<ImGuiFontCacheLoader> Wrapper : GetLoaders())
+        {
+            if (Wrapper->Inner == Atlas->FontLoader)
+            {
+                Atlas->SetFontLoader(AddressOf(Wrapper->Hooks));
+                return;
+            }
+        }
+
+        const Ptr<ImGuiFontCacheLoader> Wrapper = new ImGuiFontCacheLoader { * Atlas->FontLoader, Atlas->FontLoader };
+        Wrapper->Hooks.Name               = "Zyphryon (Cached)";
+        Wrapper->Hooks.FontSrcInit        = OnFontSrcInit;
+        Wrapper->Hooks.FontSrcDestroy     = OnFontSrcDestroy;
+        Wrapper->Hooks.FontBakedLoadGlyph = OnFontBakedLoadGlyph;
+
+        // Only hooks the wrapped loader implements are forwarded, the others keep ImGui's default behavior.
+        if (Wrapper->Hooks.FontSrcContainsGlyph)
+        {
+            Wrapper->Hooks.FontSrcContainsGlyph = OnFontSrcContainsGlyph;
+        }
+        if (Wrapper->Hooks.FontBakedInit)
+        {
+            Wrapper->Hooks.FontBakedInit = OnFontBakedInit;
+        }
+        if (Wrapper->Hooks.FontBakedDestroy)
+        {
+            Wrapper->Hooks.FontBakedDestroy = OnFontBakedDestroy;
+        }
+        GetLoaders().push_back(Wrapper);
+
+        Atlas->SetFontLoader(AddressOf(Wrapper->Hooks));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiFontCache::SetDirectory(Text Directory)
+    {
+        GetDirectory() = Directory;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt64 ImGuiFontCache::GetHash(ImWchar Codepoint, ConstPtr<ImFontConfig> Source, ConstPtr<ImFontBaked> Baked)
+    {
+        // The ascent is folded into the glyph bounds, and merged sources take it from the font they are merged into.
+        const Array<UInt32, 3> Settings {
+            GetBits(Baked->Size),
+            GetBits(Source->RasterizerDensity * Baked->RasterizerDensity),
+            GetBits(Baked->Ascent)
+        };
+        return static_cast<UInt64>(Codepoint) << 32 | ImHashData(Settings.data(), sizeof(Settings));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiFontCache::Open(ConstPtr<ImFontConfig> Source, Text Loader)
+    {
+        ConstRef<Str> Directory = GetDirectory();
+
+        if (Directory.empty())
+        {
+            return;
+        }
+
+        const Array<UInt32, 11> Settings {
+            kCacheVersion,
+            ImHashData(Loader.data(), Loader.size()),
+            static_cast<UInt32>(Source->FontNo),
+            GetBits(Source->SizePixels),
+            static_cast<UInt32>(Source->OversampleH),
+            static_cast<UInt32>(Source->OversampleV),
+            static_cast<UInt32>(Source->PixelSnapH),
+            GetBits(Source->GlyphOffset.x),
+            GetBits(Source->GlyphOffset.y),
+            Source->FontLoaderFlags,
+            static_cast<UInt32>(sizeof(ImGuiFontCacheRecord))
+        };
+
+        const ImGuiID Content = ImHashData(Source->FontData, Source->FontDataSize);
+        mKey = static_cast<UInt64>(Content) << 32 | ImHashData(Settings.data(), sizeof(Settings), Content);
+
+        Char Name[24];
+        std::snprintf(Name, sizeof(Name), "%016llx", static_cast<unsigned long long>(mKey));
+
+        mPath = Directory + "/" + Name + ".glyphs";
+        Read();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiFontCache::Close()
+    {
+        if (mDirty)
+        {
+            Write();
+            mDirty = false;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ConstPtr<ImGuiFontCache::Glyph> ImGuiFontCache::Find(UInt64 Hash) const
+    {
+        const auto Iterator = mGlyphs.find(Hash);
+        return Iterator != mGlyphs.end() ? AddressOf(Iterator->second) : nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Ptr<UInt8> ImGuiFontCache::Insert(UInt64 Hash, Glyph Entry)
+    {
+        Entry.Offset = mPixels.size();
+        mPixels.resize(mPixels.size() + Entry.Width * Entry.Height);
+
+        mGlyphs[Hash] = Entry;
+        mDirty        = IsPersistent();
+        return mPixels.data() + Entry.Offset;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiFontCache::Read()
+    {
+        const Ptr<std::FILE> File = std::fopen(mPath.c_str(), "rb");
+
+        if (File == nullptr)
+        {
+            return;
+        }
+
+        // Files written by another build or for another font are ignored, and replaced on the next write.
+        ImGuiFontCacheHeader         Header;
+        Vector<ImGuiFontCacheRecord> Records;
+
+        const SInt64 Length = std::fseek(File, 0, SEEK_END) == 0 ? std::ftell(File) : -1;
+        std::rewind(File);
+
+        Bool Valid = Length >= static_cast<SInt64>(sizeof(Header))
+            && std::fread(AddressOf(Header), sizeof(Header), 1, File) == 1
+            && Header.Magic   == kCacheMagic
+            && Header.Version == kCacheVersion
+            && Header.Key     == mKey;
+
+        // The records and the pixels they describe must account for the rest of the file exactly, so a truncated or
+        // corrupted file never makes the reader allocate more than the file holds.
+        UInt64 Remaining = Valid ? Length - sizeof(Header) : 0;
+
+        if (Valid && Header.Count <= Remaining / sizeof(ImGuiFontCacheRecord))
+        {
+            Records.resize(Header.Count);
+            Remaining -= Records.size() * sizeof(ImGuiFontCacheRecord);
+
+            Valid = std::fread(Records.data(), sizeof(ImGuiFontCacheRecord), Records.size(), File) == Records.size();
+        }
+        else
+        {
+            Valid = false;
+        }
+
+        UInt64 Total = 0;
+
+        for (UInt32 Index = 0; Valid && Index < Records.size(); ++Index)
+        {
+            ConstRef<ImGuiFontCacheRecord> Record = Records[Index];
+
+            Valid  = Record.Width <= kCacheExtent && Record.Height <= kCacheExtent;
+            Total += static_cast<UInt64>(Record.Width) * Record.Height;
+        }
+
+        if (Valid && Total == Remaining)
+        {
+            mPixels.resize(Total);
+            Valid = std::fread(mPixels.data(), 1, mPixels.size(), File) == mPixels.size();
+        }
+        else
+        {
+            Valid = false;
+        }
+        std::fclose(File);
+
+        if (!Valid)
+        {
+            mPixels.clear();
+            return;
+        }
+
+        UInt32 Offset = 0;
+
+        for (ConstRef<ImGuiFontCacheRecord> Record : Records)
+        {
+            mGlyphs[Record.Hash] = {
+                Record.X0, Record.Y0, Record.X1, Record.Y1, Record.Advance, Record.Width, Record.Height, Offset
+            };
+            Offset += Record.Width * Record.Height;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiFontCache::Write() const
+    {
+        const Ptr<std::FILE> File = std::fopen(mPath.c_str(), "wb");
+
+        if (File == nullptr)
+        {
+            return;
+        }
+
+        const ImGuiFontCacheHeader Header {
+            kCacheMagic, kCacheVersion, mKey, static_cast<UInt32>(mGlyphs.size()), 0
+        };
+        std::fwrite(AddressOf(Header), sizeof(Header), 1, File);
+
+        for (ConstRef<std::pair<const UInt64, Glyph>> Entry : mGlyphs)
+        {
+            ConstRef<Glyph> Value = Entry.second;
+
+            const ImGuiFontCacheRecord Record {
+                Entry.first, Value.X0, Value.Y0, Value.X1, Value.Y1, Value.Advance, Value.Width, Value.Height, 0
+            };
+            std::fwrite(AddressOf(Record), sizeof(Record), 1, File);
+        }
+
+        // Pixels follow in the same order as the records, so the reader can rebuild the offsets.
+        for (ConstRef<std::pair<const UInt64, Glyph>> Entry : mGlyphs)
+        {
+            std::fwrite(GetPixels(Entry.second), 1, Entry.second.Width * Entry.second.Height, File);
+        }
+        std::fclose(File);
+    }
+}
@@ -0,0 +1,143 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <imgui.h>
+#include <Zyphryon.Base/Base.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// \brief Keeps the baked glyphs of a font source, and persists them between runs.
+    ///
+    /// Every font loader of the plugin stores the glyphs it bakes here, keyed by codepoint and baked size. When a cache
+    /// directory is set, the glyphs are read from a file named after a hash of the font data and its settings when
+    /// the source is opened, and written back when it is closed, so later runs copy the glyphs instead of baking them.
+    ///
+    /// \ref Apply wraps the loader installed in an atlas with the cache, so regular fonts skip rasterization too.
+    class ImGuiFontCache final
+    {
+    public:
+
+        /// \brief Glyph kept by the cache.
+        struct Glyph
+        {
+            /// Bounds of the glyph quad, relative to the pen position.
+            Real32 X0;
+            Real32 Y0;
+            Real32 X1;
+            Real32 Y1;
+
+            /// Horizontal distance to the next pen position.
+            Real32 Advance;
+
+            /// Dimensions of the glyph bitmap in texels, zero for glyphs with nothing to draw.
+            UInt32 Width;
+            UInt32 Height;
+
+            /// Offset of the glyph bitmap within the pixels of the cache.
+            UInt32 Offset;
+        };
+
+    public:
+
+        /// Wraps the font loader installed in an atlas with the cache while a cache directory is set, and restores
+        /// the wrapped loader otherwise.
+        ///
+        /// The wrapped loader is whichever one the atlas uses (e.g. FreeType), and keeps rasterizing the glyphs that
+        /// miss the cache. Sources already added to the atlas are reloaded through the new loader.
+        ///
+        /// \param Atlas The atlas whose loader is wrapped.
+        static void Apply(Ptr<ImFontAtlas> Atlas);
+
+        /// Sets the directory where baked glyphs are cached between runs.
+        ///
+        /// Only sources added after this call use the cache, and only in atlases given to \ref Apply. Cache files are
+        /// named after a hash of the font data and the baking settings, so editing a font or changing its
+        /// configuration never reuses stale glyphs.
+        ///
+        /// \param Directory The existing directory used to store cache files, or empty to disable the cache.
+        static void SetDirectory(Text Directory);
+
+        /// Computes the key of a glyph, which identifies it among every size the source is baked at.
+        ///
+        /// \param Codepoint The codepoint of the glyph.
+        /// \param Source    The font source being baked.
+        /// \param Baked     The baked size the glyph belongs to.
+        /// \return The key of the glyph.
+        static UInt64 GetHash(ImWchar Codepoint, ConstPtr<ImFontConfig> Source, ConstPtr<ImFontBaked> Baked);
+
+    public:
+
+        /// Reads the cache file of a font source, when a cache directory is set.
+        ///
+        /// \param Source The font source.
+        /// \param Loader The name of the loader baking the glyphs, which is part of the file name hash.
+        void Open(ConstPtr<ImFontConfig> Source, Text Loader);
+
+        /// Writes the cache file back if glyphs were baked since it was read.
+        void Close();
+
+        /// Checks whether the cache persists its glyphs.
+        ///
+        /// \return `true` if a cache file backs the glyphs, `false` otherwise.
+        Bool IsPersistent() const
+        {
+            return !mPath.empty();
+        }
+
+        /// Looks up a glyph.
+        ///
+        /// \param Hash The key of the glyph.
+        /// \return The glyph, or `nullptr` if it has not been baked yet.
+        ConstPtr<Glyph> Find(UInt64 Hash) const;
+
+        /// Adds a glyph, whose bitmap must be written by the caller right away.
+        ///
+        /// \param Hash  The key of the glyph.
+        /// \param Entry The glyph, whose offset is assigned by the cache.
+        /// \return The `Width * Height` single channel texels of the glyph bitmap.
+        Ptr<UInt8> Insert(UInt64 Hash, Glyph Entry);
+
+        /// Retrieves the bitmap of a glyph.
+        ///
+        /// \param Entry The glyph.
+        /// \return The `Width * Height` single channel texels of the glyph bitmap.
+        ConstPtr<UInt8> GetPixels(ConstRef<Glyph> Entry) const
+        {
+            return mPixels.data() + Entry.Offset;
+        }
+
+    private:
+
+        /// Reads the cache file, discarding it entirely if it is malformed or belongs to another font.
+        void Read();
+
+        /// Writes every glyph to the cache file.
+        void Write() const;
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Str                  mPath;
+        UInt64               mKey   = 0;
+        Table<UInt64, Glyph> mGlyphs;
+        Vector<UInt8>        mPixels;
+        Bool                 mDirty = false;
+    };
+}
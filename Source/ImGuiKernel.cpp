@@ -0,0 +1,322 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "ImGuiKernel.hpp"
+#include <cmath>
+
+#if   defined(__AVX2__)
+    #include <immintrin.h>
+    #define ZY_IMGUI_KERNEL_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define ZY_IMGUI_KERNEL_SSE2
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+    #include <arm_neon.h>
+    #define ZY_IMGUI_KERNEL_NEON
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiKernel::Measure(ConstPtr<ImDrawVert> Input, UInt32 Count, Ref<Bounds> Range)
+    {
+        UInt32 Index = 0;
+
+        // Position and texture coordinates are the first four floats of the vertex.
+#if   defined(ZY_IMGUI_KERNEL_AVX2) || defined(ZY_IMGUI_KERNEL_SSE2)
+        __m128 Lower = _mm_loadu_ps(Range.Lower.data());
+        __m128 Upper = _mm_loadu_ps(Range.Upper.data());
+
+        for (; Index < Count; ++Index)
+        {
+            const __m128 Value = _mm_loadu_ps(& Input[Index].pos.x);
+            Lower = _mm_min_ps(Lower, Value);
+            Upper = _mm_max_ps(Upper, Value);
+        }
+        _mm_storeu_ps(Range.Lower.data(), Lower);
+        _mm_storeu_ps(Range.Upper.data(), Upper);
+#elif defined(ZY_IMGUI_KERNEL_NEON)
+        float32x4_t Lower = vld1q_f32(Range.Lower.data());
+        float32x4_t Upper = vld1q_f32(Range.Upper.data());
+
+        for (; Index < Count; ++Index)
+        {
+            const float32x4_t Value = vld1q_f32(& Input[Index].pos.x);
+            Lower = vminq_f32(Lower, Value);
+            Upper = vmaxq_f32(Upper, Value);
+        }
+        vst1q_f32(Range.Lower.data(), Lower);
+        vst1q_f32(Range.Upper.data(), Upper);
+#else
+        for (; Index < Count; ++Index)
+        {
+            ConstPtr<Real32> Value = & Input[Index].pos.x;
+
+            for (UInt32 Component = 0; Component < 4; ++Component)
+            {
+                Range.Lower[Component] = Min(Range.Lower[Component], Value[Component]);
+                Range.Upper[Component] = Max(Range.Upper[Component], Value[Component]);
+            }
+        }
+#endif
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiKernel::Fit(ConstRef<Bounds> Range, Ref<Placement> Output)
+    {
+        constexpr Real32 kPositionLimit = 32767.0f;
+
+        Output = Placement { ImVec2(0.0f, 0.0f), kPositionPrecision };
+
+        // An empty frame fits anything.
+        if (Range.Lower[0] > Range.Upper[0])
+        {
+            return true;
+        }
+
+        // Texture coordinates outside of [0, 1] (e.g. tiled images) cannot be normalized.
+        if (Range.Lower[2] < 0.0f || Range.Lower[3] < 0.0f || Range.Upper[2] > 1.0f || Range.Upper[3] > 1.0f)
+        {
+            return false;
+        }
+
+        // Centering the origin on the geometry doubles the extent a given precision can cover.
+        Output.Origin = ImVec2(
+            std::floor((Range.Lower[0] + Range.Upper[0]) * 0.5f), std::floor((Range.Lower[1] + Range.Upper[1]) * 0.5f));
+
+        const Real32 Extent = Max(
+            Max(Range.Upper[0] - Output.Origin.x, Output.Origin.x - Range.Lower[0]),
+            Max(Range.Upper[1] - Output.Origin.y, Output.Origin.y - Range.Lower[1]));
+
+        // Halving the precision keeps every step exact, down to whole pixels (e.g. 4 steps up to 8191 pixels away).
+        while (Output.Scale >= 1.0f && Extent * Output.Scale > kPositionLimit)
+        {
+            Output.Scale *= 0.5f;
+        }
+        return Output.Scale >= 1.0f;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiKernel::Pack(
+        ConstPtr<ImDrawVert> Input, Ptr<CompactVertex> Output, UInt32 Count, ConstRef<Placement> Placement)
+    {
+        constexpr Real32 kPositionLimit = 32767.0f;
+        constexpr Real32 kTextureLimit  = 65535.0f;
+
+        UInt32 Index = 0;
+
+        // Every path rounds with the default rounding mode, to the nearest step with ties to even.
+#if   defined(ZY_IMGUI_KERNEL_AVX2) || defined(ZY_IMGUI_KERNEL_SSE2)
+        const __m128  Offset = _mm_setr_ps(Placement.Origin.x, Placement.Origin.y, 0.0f, 0.0f);
+        const __m128  Scale  = _mm_setr_ps(Placement.Scale, Placement.Scale, kTextureLimit, kTextureLimit);
+        const __m128i Bias   = _mm_setr_epi32(0, 0, 32768, 32768);
+        const __m128i Sign   = _mm_setr_epi16(0, 0, -32768, -32768, 0, 0, -32768, -32768);
+
+        for (; Index < Count; ++Index)
+        {
+            // Position and texture coordinates are the first four floats of the vertex.
+            const __m128 Value = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(& Input[Index].pos.x), Offset), Scale);
+
+            // Narrow with signed saturation, biasing the texture coordinates into the signed range and back.
+            const __m128i Fixed  = _mm_sub_epi32(_mm_cvtps_epi32(Value), Bias);
+            const __m128i Packed = _mm_xor_si128(_mm_packs_epi32(Fixed, Fixed), Sign);
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(Output + Index), Packed);
+
+            Output[Index].Color = Input[Index].col;
+        }
+#elif defined(ZY_IMGUI_KERNEL_NEON)
+        const float32x4_t Offset = { Placement.Origin.x, Placement.Origin.y, 0.0f, 0.0f };
+        const float32x4_t Scale  = { Placement.Scale, Placement.Scale, kTextureLimit, kTextureLimit };
+
+        for (; Index < Count; ++Index)
+        {
+            // Position and texture coordinates are the first four floats of the vertex.
+            const float32x4_t Value = vmulq_f32(vsubq_f32(vld1q_f32(& Input[Index].pos.x), Offset), Scale);
+
+            // Narrowing keeps the low 16 bits, which is exact for both signed positions and unsigned coordinates.
+            vst1_s16(reinterpret_cast<Ptr<SInt16>>(Output + Index), vmovn_s32(vcvtnq_s32_f32(Value)));
+
+            Output[Index].Color = Input[Index].col;
+        }
+#else
+        for (; Index < Count; ++Index)
+        {
+            ConstRef<ImDrawVert> Vertex = Input[Index];
+
+            const Real32 X = (Vertex.pos.x - Placement.Origin.x) * Placement.Scale;
+            const Real32 Y = (Vertex.pos.y - Placement.Origin.y) * Placement.Scale;
+            const Real32 U = Vertex.uv.x * kTextureLimit;
+            const Real32 V = Vertex.uv.y * kTextureLimit;
+
+            Output[Index].X     = static_cast<SInt16>(std::lrint(Max(Min(X, kPositionLimit), -kPositionLimit)));
+            Output[Index].Y     = static_cast<SInt16>(std::lrint(Max(Min(Y, kPositionLimit), -kPositionLimit)));
+            Output[Index].U     = static_cast<UInt16>(std::lrint(Max(Min(U, kTextureLimit), 0.0f)));
+            Output[Index].V     = static_cast<UInt16>(std::lrint(Max(Min(V, kTextureLimit), 0.0f)));
+            Output[Index].Color = Vertex.col;
+        }
+#endif
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiKernel::Widen(ConstPtr<ImDrawVert> Input, Ptr<BatchedVertex> Output, UInt32 Count)
+    {
+        for (UInt32 Index = 0; Index < Count; ++Index)
+        {
+            // Position and texture coordinates are the first four floats of both vertices.
+#if   defined(ZY_IMGUI_KERNEL_AVX2) || defined(ZY_IMGUI_KERNEL_SSE2)
+            _mm_storeu_ps(& Output[Index].X, _mm_loadu_ps(& Input[Index].pos.x));
+#elif defined(ZY_IMGUI_KERNEL_NEON)
+            vst1q_f32(& Output[Index].X, vld1q_f32(& Input[Index].pos.x));
+#else
+            Output[Index].X       = Input[Index].pos.x;
+            Output[Index].Y       = Input[Index].pos.y;
+            Output[Index].U       = Input[Index].uv.x;
+            Output[Index].V       = Input[Index].uv.y;
+#endif
+            Output[Index].Color   = Input[Index].col;
+            Output[Index].Texture = 0;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiKernel::Rebase(ConstPtr<UInt16> Input, Ptr<UInt16> Output, UInt32 Count, UInt32 Base)
+    {
+        UInt32 Index = 0;
+
+#if   defined(ZY_IMGUI_KERNEL_AVX2)
+        const __m256i Offset = _mm256_set1_epi16(static_cast<SInt16>(Base));
+
+        for (; Index + 16 <= Count; Index += 16)
+        {
+            const __m256i Value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(Input + Index));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(Output + Index), _mm256_add_epi16(Value, Offset));
+        }
+#elif defined(ZY_IMGUI_KERNEL_SSE2)
+        const __m128i Offset = _mm_set1_epi16(static_cast<SInt16>(Base));
+
+        for (; Index + 8 <= Count; Index += 8)
+        {
+            const __m128i Value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Input + Index));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(Output + Index), _mm_add_epi16(Value, Offset));
+        }
+#elif defined(ZY_IMGUI_KERNEL_NEON)
+        const uint16x8_t Offset = vdupq_n_u16(static_cast<UInt16>(Base));
+
+        for (; Index + 8 <= Count; Index += 8)
+        {
+            vst1q_u16(Output + Index, vaddq_u16(vld1q_u16(Input + Index), Offset));
+        }
+#endif
+
+        for (; Index < Count; ++Index)
+        {
+            Output[Index] = static_cast<UInt16>(Input[Index] + Base);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiKernel::Rebase(ConstPtr<UInt16> Input, Ptr<UInt32> Output, UInt32 Count, UInt32 Base)
+    {
+        UInt32 Index = 0;
+
+#if   defined(ZY_IMGUI_KERNEL_AVX2)
+        const __m256i Offset = _mm256_set1_epi32(static_cast<SInt32>(Base));
+
+        for (; Index + 8 <= Count; Index += 8)
+        {
+            const __m128i Value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Input + Index));
+            const __m256i Wide  = _mm256_cvtepu16_epi32(Value);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(Output + Index), _mm256_add_epi32(Wide, Offset));
+        }
+#elif defined(ZY_IMGUI_KERNEL_SSE2)
+        const __m128i Offset = _mm_set1_epi32(static_cast<SInt32>(Base));
+        const __m128i Zero   = _mm_setzero_si128();
+
+        for (; Index + 8 <= Count; Index += 8)
+        {
+            const __m128i Value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Input + Index));
+            const __m128i Low   = _mm_unpacklo_epi16(Value, Zero);
+            const __m128i High  = _mm_unpackhi_epi16(Value, Zero);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(Output + Index),     _mm_add_epi32(Low, Offset));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(Output + Index + 4), _mm_add_epi32(High, Offset));
+        }
+#elif defined(ZY_IMGUI_KERNEL_NEON)
+        const uint32x4_t Offset = vdupq_n_u32(Base);
+
+        for (; Index + 8 <= Count; Index += 8)
+        {
+            const uint16x8_t Value = vld1q_u16(Input + Index);
+            vst1q_u32(Output + Index,     vaddw_u16(Offset, vget_low_u16(Value)));
+            vst1q_u32(Output + Index + 4, vaddw_u16(Offset, vget_high_u16(Value)));
+        }
+#endif
+
+        for (; Index < Count; ++Index)
+        {
+            Output[Index] = Input[Index] + Base;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiKernel::Rebase(ConstPtr<UInt32> Input, Ptr<UInt32> Output, UInt32 Count, UInt32 Base)
+    {
+        UInt32 Index = 0;
+
+#if   defined(ZY_IMGUI_KERNEL_AVX2)
+        const __m256i Offset = _mm256_set1_epi32(static_cast<SInt32>(Base));
+
+        for (; Index + 8 <= Count; Index += 8)
+        {
+            const __m256i Value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(Input + Index));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(Output + Index), _mm256_add_epi32(Value, Offset));
+        }
+#elif defined(ZY_IMGUI_KERNEL_SSE2)
+        const __m128i Offset = _mm_set1_epi32(static_cast<SInt32>(Base));
+
+        for (; Index + 4 <= Count; Index += 4)
+        {
+            const __m128i Value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Input + Index));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(Output + Index), _mm_add_epi32(Value, Offset));
+        }
+#elif defined(ZY_IMGUI_KERNEL_NEON)
+        const uint32x4_t Offset = vdupq_n_u32(Base);
+
+        for (; Index + 4 <= Count; Index += 4)
+        {
+            vst1q_u32(Output + Index, vaddq_u32(vld1q_u32(Input + Index), Offset));
+        }
+#endif
+
+        for (; Index < Count; ++Index)
+        {
+            Output[Index] = Input[Index] + Base;
+        }
+    }
+}
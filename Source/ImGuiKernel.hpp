@@ -0,0 +1,140 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <imgui.h>
+#include <cfloat>
+#include <Zyphryon.Graphic/Technique.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// \brief Vectorized kernels used while copying ImGui geometry into device memory.
+    ///
+    /// Every kernel picks the widest instruction set available at compile time (AVX2, SSE2 or AArch64 NEON) and falls
+    /// back to scalar code for the remaining elements or on other architectures, including 32-bit ARM.
+    class ImGuiKernel final
+    {
+    public:
+
+        /// \brief Compact vertex holding fixed point positions, normalized texture coordinates and a packed color.
+        struct CompactVertex
+        {
+            /// Position relative to the origin of the frame, in fixed point at the precision of the frame.
+            SInt16 X, Y;
+
+            /// Texture coordinates, normalized to the full 16-bit range.
+            UInt16 U, V;
+
+            /// Color in the same packed layout as ImGui's vertices.
+            UInt32 Color;
+        };
+
+        /// \brief Vertex carrying, next to ImGui's own attributes, which texture slot it samples and how.
+        struct BatchedVertex
+        {
+            /// Position, in the same units as ImGui's vertices.
+            Real32 X, Y;
+
+            /// Texture coordinates, in the same units as ImGui's vertices.
+            Real32 U, V;
+
+            /// Color in the same packed layout as ImGui's vertices.
+            UInt32 Color;
+
+            /// Texture slot in the lowest byte and shading kind in the next one.
+            UInt32 Texture;
+        };
+
+        /// \brief Range covered by the positions and texture coordinates of vertices, as (X, Y, U, V).
+        struct Bounds
+        {
+            /// Smallest position and texture coordinates.
+            Array<Real32, 4> Lower { +FLT_MAX, +FLT_MAX, +FLT_MAX, +FLT_MAX };
+
+            /// Largest position and texture coordinates.
+            Array<Real32, 4> Upper { -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        };
+
+        /// \brief Mapping of the positions of a frame to the fixed point positions of its compact vertices.
+        struct Placement
+        {
+            /// Position stored as zero.
+            ImVec2 Origin;
+
+            /// Number of fixed point steps per pixel, a power of two.
+            Real32 Scale;
+        };
+
+        /// Largest number of fixed point steps per pixel of a compact vertex's position.
+        static constexpr Real32 kPositionPrecision = 8.0f;
+
+        /// Widens a range to cover the positions and texture coordinates of vertices.
+        ///
+        /// \param Input The vertices to measure.
+        /// \param Count The number of vertices to measure.
+        /// \param Range The range to widen.
+        static void Measure(ConstPtr<ImDrawVert> Input, UInt32 Count, Ref<Bounds> Range);
+
+        /// Picks the placement of a frame's compact vertices, keeping as much precision as the extent of the frame
+        /// allows.
+        ///
+        /// \param Range  The range covered by every vertex of the frame.
+        /// \param Output The placement of the frame.
+        /// \return `true` if the frame fits the compact format, `false` otherwise.
+        static Bool Fit(ConstRef<Bounds> Range, Ref<Placement> Output);
+
+        /// Packs vertices into the compact format, rounding to the nearest step with ties to even.
+        ///
+        /// \param Input     The vertices to pack, which must lie within the range the placement was fit to.
+        /// \param Output    The destination of the packed vertices.
+        /// \param Count     The number of vertices to pack.
+        /// \param Placement The placement of the frame.
+        static void Pack(
+            ConstPtr<ImDrawVert> Input, Ptr<CompactVertex> Output, UInt32 Count, ConstRef<Placement> Placement);
+
+        /// Copies vertices into the batched format, leaving their texture unassigned.
+        ///
+        /// \param Input  The vertices to copy.
+        /// \param Output The destination of the copied vertices.
+        /// \param Count  The number of vertices to copy.
+        static void Widen(ConstPtr<ImDrawVert> Input, Ptr<BatchedVertex> Output, UInt32 Count);
+
+        /// Copies 16-bit indices while adding a vertex base to each of them.
+        ///
+        /// \param Input  The indices to copy.
+        /// \param Output The destination of the rebased indices.
+        /// \param Count  The number of indices to copy.
+        /// \param Base   The vertex base added to every index, which must keep every result within 16 bits.
+        static void Rebase(ConstPtr<UInt16> Input, Ptr<UInt16> Output, UInt32 Count, UInt32 Base);
+
+        /// Copies 16-bit indices while widening them to 32 bits and adding a vertex base to each of them.
+        ///
+        /// \param Input  The indices to copy.
+        /// \param Output The destination of the rebased indices.
+        /// \param Count  The number of indices to copy.
+        /// \param Base   The vertex base added to every index.
+        static void Rebase(ConstPtr<UInt16> Input, Ptr<UInt32> Output, UInt32 Count, UInt32 Base);
+
+        /// Copies 32-bit indices while adding a vertex base to each of them.
+        ///
+        /// \param Input  The indices to copy.
+        /// \param Output The destination of the rebased indices.
+        /// \param Count  The number of indices to copy.
+        /// \param Base   The vertex base added to every index.
+        static void Rebase(ConstPtr<UInt32> Input, Ptr<UInt32> Output, UInt32 Count, UInt32 Base);
+    };
+}
@@ -0,0 +1,78 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+#include <atomic>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// \brief Bounded lock-free queue with a single producer thread and a single consumer thread.
+    ///
+    /// \tparam Type     The type of the elements, which must be trivially copyable.
+    /// \tparam Capacity The maximum number of elements in the queue, which must be a power of two.
+    template<typename Type, UInt32 Capacity>
+    class ImGuiQueue final
+    {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+
+        /// Appends an element to the queue, called from the producer thread only.
+        ///
+        /// \param Value The element to append.
+        /// \return `true` if the element was appended, `false` if the queue is full.
+        Bool Push(ConstRef<Type> Value)
+        {
+            const UInt32 Tail = mTail.load(std::memory_order_relaxed);
+
+            if (Tail - mHead.load(std::memory_order_acquire) == Capacity)
+            {
+                return false;
+            }
+
+            mElements[Tail & (Capacity - 1)] = Value;
+            mTail.store(Tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// Removes every element in the queue in order, called from the consumer thread only.
+        ///
+        /// \param Callback The function invoked with each element.
+        template<typename Function>
+        void Drain(Function && Callback)
+        {
+            const UInt32 Tail = mTail.load(std::memory_order_acquire);
+            UInt32       Head = mHead.load(std::memory_order_relaxed);
+
+            for (; Head != Tail; ++Head)
+            {
+                Callback(mElements[Head & (Capacity - 1)]);
+            }
+            mHead.store(Head, std::memory_order_release);
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        alignas(64) std::atomic<UInt32> mHead = 0;
+        alignas(64) std::atomic<UInt32> mTail = 0;
+        Array<Type, Capacity>           mElements;
+    };
+}
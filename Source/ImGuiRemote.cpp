@@ -0,0 +1,664 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "ImGuiRemote.hpp"
+
+#if defined(_WIN32)
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <arpa/inet.h>
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    using namespace ImGuiCaptureFormat;
+
+#if defined(_WIN32)
+    using Socket = SOCKET;
+#else
+    using Socket = int;
+#endif
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool Startup()
+    {
+#if defined(_WIN32)
+        static const Bool Ready = []()
+        {
+            WSADATA Data;
+            return WSAStartup(MAKEWORD(2, 2), AddressOf(Data)) == 0;
+        }();
+        return Ready;
+#else
+        return true;
+#endif
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Destroy(UInt64 Handle)
+    {
+#if defined(_WIN32)
+        closesocket(static_cast<Socket>(Handle));
+#else
+        close(static_cast<Socket>(Handle));
+#endif
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool Configure(Socket Handle, Bool Stream)
+    {
+        // Streams carry small, latency bound messages, which must not wait for the Nagle algorithm.
+        if (Stream)
+        {
+            const int Enable = 1;
+            const auto Value = reinterpret_cast<const char *>(AddressOf(Enable));
+            setsockopt(Handle, IPPROTO_TCP, TCP_NODELAY, Value, sizeof(Enable));
+        }
+
+#if defined(_WIN32)
+        u_long Mode = 1;
+        return ioctlsocket(Handle, FIONBIO, AddressOf(Mode)) == 0;
+#else
+        return fcntl(Handle, F_SETFL, fcntl(Handle, F_GETFL, 0) | O_NONBLOCK) == 0;
+#endif
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool IsBlocked()
+    {
+#if defined(_WIN32)
+        return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Put(Ref<Vector<Byte>> Output, ConstPtr<void> Data, UInt32 Size)
+    {
+        const ConstPtr<Byte> Bytes = static_cast<ConstPtr<Byte>>(Data);
+        Output.insert(Output.end(), Bytes, Bytes + Size);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Put(Ref<Vector<Byte>> Output, UInt32 Value)
+    {
+        Put(Output, AddressOf(Value), sizeof(Value));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ImGuiRemote::~ImGuiRemote()
+    {
+        Close();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiRemote::Listen(UInt16 Port, Text Address)
+    {
+        Close();
+
+        if (!Startup())
+        {
+            return false;
+        }
+
+        sockaddr_in Endpoint { };
+        Endpoint.sin_family = AF_INET;
+        Endpoint.sin_port   = htons(Port);
+
+        if (inet_pton(AF_INET, Str(Address).c_str(), AddressOf(Endpoint.sin_addr)) != 1)
+        {
+            return false;
+        }
+
+        const Socket Listener = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+        if (static_cast<UInt64>(Listener) == kInvalid)
+        {
+            return false;
+        }
+
+        const int Reuse = 1;
+        setsockopt(Listener, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char *>(AddressOf(Reuse)), sizeof(Reuse));
+
+        if (bind(Listener, reinterpret_cast<const sockaddr *>(AddressOf(Endpoint)), sizeof(Endpoint)) != 0
+            || listen(Listener, 1) != 0 || !Configure(Listener, false))
+        {
+            Destroy(static_cast<UInt64>(Listener));
+            return false;
+        }
+
+        mListener = static_cast<UInt64>(Listener);
+        mRole     = Role::Server;
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiRemote::Connect(Text Address, UInt16 Port)
+    {
+        Close();
+
+        if (!Startup())
+        {
+            return false;
+        }
+
+        sockaddr_in Endpoint { };
+        Endpoint.sin_family = AF_INET;
+        Endpoint.sin_port   = htons(Port);
+
+        if (inet_pton(AF_INET, Str(Address).c_str(), AddressOf(Endpoint.sin_addr)) != 1)
+        {
+            return false;
+        }
+
+        const Socket Peer = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+        if (static_cast<UInt64>(Peer) == kInvalid)
+        {
+            return false;
+        }
+
+        // Connect while still blocking, so failures are reported right away.
+        if (connect(Peer, reinterpret_cast<const sockaddr *>(AddressOf(Endpoint)), sizeof(Endpoint)) != 0
+            || !Configure(Peer, true))
+        {
+            Destroy(static_cast<UInt64>(Peer));
+            return false;
+        }
+
+        mPeer = static_cast<UInt64>(Peer);
+        mRole = Role::Viewer;
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRemote::Close()
+    {
+        Disconnect();
+
+        if (mListener != kInvalid)
+        {
+            Destroy(mListener);
+            mListener = kInvalid;
+        }
+        mRole = Role::None;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRemote::Publish(ConstRef<ImDrawData> Commands)
+    {
+        if (IsConnected())
+        {
+            Flush();
+
+            // Texture operations are acknowledged below whether the viewer receives them or not, so frames carrying
+            // them are always sent; other frames are dropped while the previous one is still in flight.
+            Bool Operations = false;
+
+            if (Commands.Textures != nullptr)
+            {
+                for (const ConstPtr<ImTextureData> Texture : * Commands.Textures)
+                {
+                    Operations |= Texture->Status != ImTextureStatus_OK && Texture->Status != ImTextureStatus_Destroyed;
+                }
+            }
+
+            if (mOutbox.empty() || Operations)
+            {
+                Compress(mEncoder.Encode(Commands));
+                Flush();
+            }
+        }
+
+        if (Commands.Textures != nullptr)
+        {
+            for (const Ptr<ImTextureData> Texture : * Commands.Textures)
+            {
+                switch (Texture->Status)
+                {
+                case ImTextureStatus_WantCreate:
+                    Texture->SetTexID(static_cast<ImTextureID>(Texture->UniqueID) + 1);
+                    Texture->SetStatus(ImTextureStatus_OK);
+                    break;
+                case ImTextureStatus_WantUpdates:
+                    Texture->SetStatus(ImTextureStatus_OK);
+                    break;
+                case ImTextureStatus_WantDestroy:
+                    Texture->SetTexID(ImTextureID_Invalid);
+                    Texture->SetStatus(ImTextureStatus_Destroyed);
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRemote::Send(Message Type, ConstSpan<Byte> Payload)
+    {
+        if (IsConnected())
+        {
+            Put(mOutbox, static_cast<UInt32>(Payload.size()));
+            Put(mOutbox, Enum::Cast(Type));
+            Put(mOutbox, Payload.data(), Payload.size());
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiRemote::Accept()
+    {
+        if (mListener == kInvalid || IsConnected())
+        {
+            return false;
+        }
+
+        const Socket Peer = accept(static_cast<Socket>(mListener), nullptr, nullptr);
+
+        if (static_cast<UInt64>(Peer) == kInvalid)
+        {
+            return false;
+        }
+
+        if (!Configure(Peer, true))
+        {
+            Destroy(static_cast<UInt64>(Peer));
+            return false;
+        }
+        mPeer = static_cast<UInt64>(Peer);
+
+        // A new viewer starts from scratch, so it needs every live texture and full draw lists.
+        mEncoder.Reset();
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRemote::Disconnect()
+    {
+        if (mPeer != kInvalid)
+        {
+            Destroy(mPeer);
+            mPeer = kInvalid;
+        }
+
+        mHistory.clear();
+        mOutbox.clear();
+        mInbox.clear();
+        mConsumed = 0;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRemote::Flush()
+    {
+#if defined(MSG_NOSIGNAL)
+        static constexpr int kFlags = MSG_NOSIGNAL;
+#else
+        static constexpr int kFlags = 0;
+#endif
+
+        UInt32 Sent = 0;
+
+        while (Sent < mOutbox.size())
+        {
+            const auto Data   = reinterpret_cast<const char *>(mOutbox.data() + Sent);
+            const auto Result = send(static_cast<Socket>(mPeer), Data, static_cast<int>(mOutbox.size() - Sent), kFlags);
+
+            if (Result > 0)
+            {
+                Sent += static_cast<UInt32>(Result);
+            }
+            else if (Result < 0 && IsBlocked())
+            {
+                break;
+            }
+            else
+            {
+                Disconnect();
+                return;
+            }
+        }
+        mOutbox.erase(mOutbox.begin(), mOutbox.begin() + Sent);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRemote::Receive()
+    {
+        static constexpr UInt32 kChunk = 64 * 1024;
+
+        // Discard the messages handed over by the previous poll.
+        mInbox.erase(mInbox.begin(), mInbox.begin() + mConsumed);
+        mConsumed = 0;
+
+        while (IsConnected())
+        {
+            const UInt32 Offset = static_cast<UInt32>(mInbox.size());
+            mInbox.resize(Offset + kChunk);
+
+            const auto Data   = reinterpret_cast<char *>(mInbox.data() + Offset);
+            const auto Result = recv(static_cast<Socket>(mPeer), Data, kChunk, 0);
+
+            if (Result > 0)
+            {
+                mInbox.resize(Offset + static_cast<UInt32>(Result));
+            }
+            else
+            {
+                mInbox.resize(Offset);
+
+                if (Result == 0 || !IsBlocked())
+                {
+                    Disconnect();
+                }
+                break;
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiRemote::Next(Ref<Message> Type, Ref<ConstSpan<Byte>> Payload)
+    {
+        const UInt32 Available = static_cast<UInt32>(mInbox.size()) - mConsumed;
+
+        if (Available < kHeader)
+        {
+            return false;
+        }
+
+        UInt32 Header[2];
+        std::memcpy(Header, mInbox.data() + mConsumed, kHeader);
+
+        if (Available - kHeader < Header[0])
+        {
+            return false;
+        }
+
+        Type    = static_cast<Message>(Header[1]);
+        Payload = ConstSpan<Byte>(mInbox.data() + mConsumed + kHeader, Header[0]);
+
+        mConsumed += kHeader + Header[0];
+
+        if (Type == Message::Frame)
+        {
+            // A frame that cannot be rebuilt leaves both ends out of sync, so the connection is dropped.
+            if (!Decompress(Payload))
+            {
+                Disconnect();
+                return false;
+            }
+            Payload = ConstSpan<Byte>(mFrame.data(), mFrame.size());
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRemote::Compress(ConstSpan<Byte> Data)
+    {
+        // Locate the end of the texture records, which are sent as they are.
+        ConstPtr<Byte>        Cursor = Data.data();
+        const ConstPtr<Byte>  End    = Data.data() + Data.size();
+        const ConstPtr<Frame> Record = Fetch<Frame>(Cursor, End);
+
+        for (UInt32 Index = 0; Index < Record->Textures; ++Index)
+        {
+            Fetch<Byte>(Cursor, End, Fetch<Texture>(Cursor, End)->Size);
+        }
+
+        const UInt32 Offset = static_cast<UInt32>(mOutbox.size());
+        const UInt32 Prefix = static_cast<UInt32>(Cursor - Data.data());
+
+        mOutbox.resize(Offset + kHeader);
+        Put(mOutbox, Prefix);
+        Put(mOutbox, Data.data(), Prefix);
+
+        mHistory.resize(Record->Lists);
+
+        // Every draw list becomes a series of segments, each skipping the bytes equal to the previous frame's list and
+        // then carrying the bytes that differ. Bytes past the last segment are equal to the previous list as well.
+        for (UInt32 Index = 0; Index < Record->Lists; ++Index)
+        {
+            const ConstPtr<Byte> Start = Cursor;
+            const ConstPtr<List> Entry = Fetch<List>(Cursor, End);
+            Fetch<Command>(Cursor, End, Entry->Commands);
+            Fetch<ImDrawVert>(Cursor, End, Entry->Vertices);
+            Fetch<ImDrawIdx>(Cursor, End, Entry->Indices);
+
+            const ConstPtr<Byte> Previous = mHistory[Index].data();
+            const UInt32         Limit    = static_cast<UInt32>(mHistory[Index].size());
+            const UInt32         Size     = static_cast<UInt32>(Cursor - Start);
+
+            const UInt32 Header = static_cast<UInt32>(mOutbox.size());
+            Put(mOutbox, Size);
+            Put(mOutbox, 0u);
+
+            UInt32 Segments = 0;
+            UInt32 Position = 0;
+
+            while (Position < Size)
+            {
+                UInt32 Skip = 0;
+
+                while (Position + Skip < Min(Size, Limit) && Start[Position + Skip] == Previous[Position + Skip])
+                {
+                    ++Skip;
+                }
+
+                if (Position + Skip == Size)
+                {
+                    break;
+                }
+
+                // Extend the literal run until enough bytes in a row match again.
+                const UInt32 First = Position + Skip;
+                UInt32       Last  = First;
+                UInt32       Run   = 0;
+
+                while (Last + Run < Size && Run < kMatchRun)
+                {
+                    if (const UInt32 At = Last + Run; At < Limit && Start[At] == Previous[At])
+                    {
+                        ++Run;
+                    }
+                    else
+                    {
+                        Last = At + 1;
+                        Run  = 0;
+                    }
+                }
+
+                Put(mOutbox, Skip);
+                Put(mOutbox, Last - First);
+                Put(mOutbox, Start + First, Last - First);
+
+                ++Segments;
+                Position = Last;
+            }
+            std::memcpy(AddressOf(mOutbox[Header + sizeof(UInt32)]), AddressOf(Segments), sizeof(Segments));
+
+            mHistory[Index].assign(Start, Cursor);
+        }
+
+        const UInt32 Header[2] = { static_cast<UInt32>(mOutbox.size() - Offset - kHeader), Enum::Cast(Message::Frame) };
+        std::memcpy(AddressOf(mOutbox[Offset]), Header, kHeader);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiRemote::Decompress(ConstSpan<Byte> Data)
+    {
+        ConstPtr<Byte>       Cursor = Data.data();
+        const ConstPtr<Byte> End    = Data.data() + Data.size();
+
+        const auto Take = [&](UInt32 Size) -> ConstPtr<Byte>
+        {
+            if (static_cast<UInt32>(End - Cursor) < Size)
+            {
+                return nullptr;
+            }
+            const ConstPtr<Byte> Result = Cursor;
+            Cursor += Size;
+            return Result;
+        };
+
+        const auto Read = [&](Ref<UInt32> Value)
+        {
+            const ConstPtr<Byte> Source = Take(sizeof(UInt32));
+
+            if (Source)
+            {
+                std::memcpy(AddressOf(Value), Source, sizeof(UInt32));
+            }
+            return Source != nullptr;
+        };
+
+        UInt32 Prefix;
+
+        if (!Read(Prefix) || Prefix < sizeof(Frame))
+        {
+            return false;
+        }
+
+        const ConstPtr<Byte> Head = Take(Prefix);
+
+        if (Head == nullptr)
+        {
+            return false;
+        }
+        mFrame.assign(Head, Head + Prefix);
+
+        Frame Record;
+        std::memcpy(AddressOf(Record), Head, sizeof(Record));
+
+        // Every draw list carries at least its size and segment count, which bounds the lists a peer can announce.
+        if (Record.Lists > static_cast<UInt32>(End - Cursor) / (2 * sizeof(UInt32)))
+        {
+            return false;
+        }
+        mHistory.resize(Record.Lists);
+
+        for (UInt32 Index = 0; Index < Record.Lists; ++Index)
+        {
+            Ref<Vector<Byte>> Previous = mHistory[Index];
+
+            UInt32 Size;
+            UInt32 Segments;
+
+            if (!Read(Size) || !Read(Segments))
+            {
+                return false;
+            }
+
+            // A list is made of bytes kept from the previous frame and literal bytes still to be read, so any larger
+            // size is rejected before the frame grows to hold it.
+            if (Size > Previous.size() + static_cast<UInt64>(End - Cursor))
+            {
+                return false;
+            }
+
+            const UInt32 Offset   = static_cast<UInt32>(mFrame.size());
+            UInt32       Position = 0;
+
+            mFrame.resize(Offset + Size);
+
+            for (UInt32 Segment = 0; Segment < Segments; ++Segment)
+            {
+                UInt32 Skip;
+                UInt32 Count;
+
+                if (!Read(Skip) || !Read(Count))
+                {
+                    return false;
+                }
+
+                const UInt64 Kept = static_cast<UInt64>(Position) + Skip;
+
+                if (Kept > Previous.size() || Kept + Count > Size)
+                {
+                    return false;
+                }
+
+                const ConstPtr<Byte> Literal = Take(Count);
+
+                if (Literal == nullptr)
+                {
+                    return false;
+                }
+
+                std::memcpy(mFrame.data() + Offset + Position, Previous.data() + Position, Skip);
+                Position += Skip;
+                std::memcpy(mFrame.data() + Offset + Position, Literal, Count);
+                Position += Count;
+            }
+
+            if (Position < Size && Size > Previous.size())
+            {
+                return false;
+            }
+            std::memcpy(mFrame.data() + Offset + Position, Previous.data() + Position, Size - Position);
+
+            Previous.assign(mFrame.begin() + Offset, mFrame.end());
+        }
+
+        // The rebuilt frame is handed to readers of the capture format, which expect its size in the header.
+        const UInt32 Total = static_cast<UInt32>(mFrame.size());
+        std::memcpy(mFrame.data(), AddressOf(Total), sizeof(Total));
+        return true;
+    }
+}
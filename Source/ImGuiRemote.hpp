@@ -0,0 +1,182 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "ImGuiCapture.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// \brief Streams ImGui frames to a viewer over TCP, and carries the viewer's input back.
+    ///
+    /// The server serializes frames in the capture format (see \ref ImGuiCaptureFormat) and sends every draw list as a
+    /// delta against the same draw list of the previous frame, so a UI that barely changes costs a few bytes per list.
+    /// Texture operations are acknowledged locally, so the server never touches a graphics device. The viewer rebuilds
+    /// the frames and hands them to \ref ImGuiReplay for rendering.
+    class ImGuiRemote final
+    {
+    public:
+
+        /// \brief Roles of an endpoint.
+        enum class Role : UInt8
+        {
+            None,   ///< The endpoint is closed.
+            Server, ///< The endpoint builds the UI and streams its frames.
+            Viewer, ///< The endpoint renders the frames it receives and sends its input.
+        };
+
+        /// \brief Kinds of messages exchanged by the endpoints.
+        enum class Message : UInt32
+        {
+            Frame = 1, ///< A frame, sent by the server.
+            Input = 2, ///< An input event, sent by the viewer.
+        };
+
+    public:
+
+        /// Ensures the sockets are closed.
+        ~ImGuiRemote();
+
+        /// Starts accepting a viewer on the given port.
+        ///
+        /// The viewer is not authenticated, so only bind to an interface other than the loopback one on trusted
+        /// networks, since whoever connects drives the UI.
+        ///
+        /// \param Port    The TCP port to listen on.
+        /// \param Address The numeric address of the interface to listen on (e.g. `0.0.0.0` for every interface).
+        /// \return `true` if the port is being listened on, `false` otherwise.
+        Bool Listen(UInt16 Port, Text Address = "127.0.0.1");
+
+        /// Connects to a server.
+        ///
+        /// \param Address The numeric address of the server (e.g. `127.0.0.1`).
+        /// \param Port    The TCP port the server listens on.
+        /// \return `true` if the connection was established, `false` otherwise.
+        Bool Connect(Text Address, UInt16 Port);
+
+        /// Closes every socket and discards any pending data.
+        void Close();
+
+        /// Accepts a pending viewer, if no viewer is connected yet.
+        ///
+        /// \return `true` if a viewer was just accepted, `false` otherwise.
+        Bool Accept();
+
+        /// Streams a frame to the viewer, then acknowledges its texture operations.
+        ///
+        /// While the viewer falls behind, frames without texture operations are dropped instead of queued.
+        ///
+        /// \param Commands The ImGui draw data to stream.
+        void Publish(ConstRef<ImDrawData> Commands);
+
+        /// Queues a message for the other endpoint, sent by the next \ref Poll or \ref Publish.
+        ///
+        /// \param Type    The kind of the message.
+        /// \param Payload The contents of the message.
+        void Send(Message Type, ConstSpan<Byte> Payload);
+
+        /// Sends the queued messages, then receives every message available, without blocking.
+        ///
+        /// Frames are handed over fully rebuilt, in the capture format, and stay valid until the callback returns.
+        ///
+        /// \param Callback The function invoked with the kind and the contents of every message.
+        template<typename Function>
+        void Poll(AnyRef<Function> Callback)
+        {
+            Flush();
+            Receive();
+
+            Message         Type;
+            ConstSpan<Byte> Payload;
+
+            while (Next(Type, Payload))
+            {
+                Callback(Type, Payload);
+            }
+        }
+
+        /// Retrieves the role of the endpoint.
+        ///
+        /// \return The role of the endpoint.
+        Role GetRole() const
+        {
+            return mRole;
+        }
+
+        /// Checks whether the other endpoint is connected.
+        ///
+        /// \return `true` if a peer is connected, `false` otherwise.
+        Bool IsConnected() const
+        {
+            return mPeer != kInvalid;
+        }
+
+    private:
+
+        /// Drops the connection to the other endpoint.
+        void Disconnect();
+
+        /// Sends as much of the queued data as the socket takes without blocking.
+        void Flush();
+
+        /// Reads every byte available on the socket without blocking.
+        void Receive();
+
+        /// Extracts the next complete message from the received data.
+        ///
+        /// \param Type    The kind of the message.
+        /// \param Payload The contents of the message.
+        /// \return `true` if a message was extracted, `false` if more data is needed.
+        Bool Next(Ref<Message> Type, Ref<ConstSpan<Byte>> Payload);
+
+        /// Queues a frame, encoding each of its draw lists against the previous frame.
+        ///
+        /// \param Frame The frame in the capture format.
+        void Compress(ConstSpan<Byte> Frame);
+
+        /// Rebuilds a frame from its delta encoding.
+        ///
+        /// \param Data The delta encoded frame.
+        /// \return `true` if the frame was rebuilt, `false` if it is malformed.
+        Bool Decompress(ConstSpan<Byte> Data);
+
+    private:
+
+        /// Value of a socket that is not open.
+        static constexpr UInt64 kInvalid  = ~0ull;
+
+        /// Number of matching bytes that ends a literal run of a delta, so short matches do not split it.
+        static constexpr UInt32 kMatchRun = 16;
+
+        /// Size in bytes of a message header, holding the payload size and the message kind.
+        static constexpr UInt32 kHeader   = 2 * sizeof(UInt32);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Role                 mRole     = Role::None;
+        UInt64               mListener = kInvalid;
+        UInt64               mPeer     = kInvalid;
+        ImGuiCapture         mEncoder;
+        Vector<Vector<Byte>> mHistory;
+        Vector<Byte>         mOutbox;
+        Vector<Byte>         mInbox;
+        UInt32               mConsumed = 0;
+        Vector<Byte>         mFrame;
+    };
+}
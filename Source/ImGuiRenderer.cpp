@@ -11,7 +11,12 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "ImGuiRenderer.hpp"
-#include <Zyphryon.Math/Matrix4x4.hpp>
+#include "ImGuiDistanceFont.hpp"
+#include "ImGuiFontCache.hpp"
+#include "ImGuiKernel.hpp"
+#include "ImGuiWorkers.hpp"
+#include <imgui_internal.h>
+#include <mutex>
 #include <Zyphryon.Content/Service.hpp>
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -20,6 +25,89 @@
 
 namespace Plugin
 {
+    // The graphics service is shared by every renderer, which may submit from different threads at the same time.
+    static std::mutex sGraphicsLock;
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool Clip(ConstRef<ImDrawData> Commands, ConstRef<ImVec4> Rectangle, Ref<Graphic::Scissor> Scissor)
+    {
+        const Real32 MinX = Max(Rectangle.x - Commands.DisplayPos.x, 0.0f);
+        const Real32 MinY = Max(Rectangle.y - Commands.DisplayPos.y, 0.0f);
+        const Real32 MaxX = Min(Rectangle.z - Commands.DisplayPos.x, Commands.DisplaySize.x);
+        const Real32 MaxY = Min(Rectangle.w - Commands.DisplayPos.y, Commands.DisplaySize.y);
+
+        if (MaxX <= MinX || MaxY <= MinY)
+        {
+            return false;
+        }
+
+        Scissor = Graphic::Scissor(
+            static_cast<UInt16>(MinX),
+            static_cast<UInt16>(MinY),
+            static_cast<UInt16>(MaxX - MinX),
+            static_cast<UInt16>(MaxY - MinY));
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt64 GetHash(ConstPtr<Byte> Data, UInt32 Size, UInt64 Seed)
+    {
+        constexpr UInt64 Prime = 0x9E3779B97F4A7C15ull;
+
+        UInt64 Hash   = Seed ^ (Size * Prime);
+        UInt32 Offset = 0;
+
+        for (; Offset + sizeof(UInt64) <= Size; Offset += sizeof(UInt64))
+        {
+            UInt64 Word;
+            std::memcpy(AddressOf(Word), Data + Offset, sizeof(UInt64));
+
+            Hash  = (Hash ^ Word) * Prime;
+            Hash ^= Hash >> 32;
+        }
+
+        for (; Offset < Size; ++Offset)
+        {
+            Hash = (Hash ^ Data[Offset]) * Prime;
+        }
+        return Hash ^ (Hash >> 29);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt64 GetPoolKey(ConstPtr<ImTextureData> Texture)
+    {
+        return static_cast<UInt64>(Texture->Format) << 48
+            | static_cast<UInt64>(Texture->Width)   << 24
+            | static_cast<UInt64>(Texture->Height);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool CanBatch(ConstRef<ImDrawCmd> Previous, ConstRef<ImDrawCmd> Current)
+    {
+        return Previous.VtxOffset   == Current.VtxOffset
+            && Previous.ClipRect.x  == Current.ClipRect.x
+            && Previous.ClipRect.y  == Current.ClipRect.y
+            && Previous.ClipRect.z  == Current.ClipRect.z
+            && Previous.ClipRect.w  == Current.ClipRect.w
+            && Previous.IdxOffset + Previous.ElemCount == Current.IdxOffset;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool CanMerge(ConstRef<ImDrawCmd> Previous, ConstRef<ImDrawCmd> Current)
+    {
+        return Previous.GetTexID() == Current.GetTexID() && CanBatch(Previous, Current);
+    }
+
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
@@ -28,15 +116,40 @@ namespace Plugin
         mGraphics = Host.GetService<Graphic::Service>();
 
         ConstRetainer<Content::Service> Content = Host.GetService<Content::Service>();
-        mTechnique = Content->Load<Graphic::Technique>("Embedded://Technique/UI/ImGui.vfx");
+        mTechnique      = Content->Load<Graphic::Technique>("Embedded://Technique/UI/ImGui.vfx");
+        mTechniqueAlpha = Content->Load<Graphic::Technique>("Embedded://Technique/UI/ImGuiAlpha.vfx");
+        mTechniqueSDF   = Content->Load<Graphic::Technique>("Embedded://Technique/UI/ImGuiDistance.vfx");
+
+        mTechniqueCompact      = Content->Load<Graphic::Technique>("Embedded://Technique/UI/ImGuiCompact.vfx");
+        mTechniqueAlphaCompact = Content->Load<Graphic::Technique>("Embedded://Technique/UI/ImGuiAlphaCompact.vfx");
+        mTechniqueSDFCompact   = Content->Load<Graphic::Technique>("Embedded://Technique/UI/ImGuiDistanceCompact.vfx");
+        mTechniqueBatch        = Content->Load<Graphic::Technique>("Embedded://Technique/UI/ImGuiBatch.vfx");
 
         ConstRef<Graphic::Capabilities> Capabilities = mGraphics->GetDescription().Capabilities;
 
+        // Select the command translation specialized for the device, keeping capability checks out of the inner loop.
+        // Without base-vertex support transient indices are rebased while copied, so every command shares one vertex
+        // stream; retained buffers are uploaded once per draw list and keep offsetting the vertex stream instead.
+        if (Capabilities.SupportsBaseVertex)
+        {
+            mBuild         = &ImGuiRenderer::Build<Addressing::BaseVertex>;
+            mBuildRetained = &ImGuiRenderer::Build<Addressing::BaseVertex>;
+        }
+        else
+        {
+            mBuild         = &ImGuiRenderer::Build<Addressing::Rebase>;
+            mBuildRetained = &ImGuiRenderer::Build<Addressing::Offset>;
+        }
+        mRebase = !Capabilities.SupportsBaseVertex;
+        ImGuiWorkers::Acquire();
+
         Ref<ImGuiIO> IO = ImGui::GetIO();
         IO.BackendRendererName = "Zyphryon";
         IO.BackendFlags = SetBit(IO.BackendFlags, ImGuiBackendFlags_RendererHasTextures);
         IO.BackendFlags = SetBit(IO.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
 
+        ImGuiFontCache::Apply(IO.Fonts);
+
         Ref<ImGuiPlatformIO> PlatformIO = ImGui::GetPlatformIO();
         PlatformIO.Renderer_TextureMaxWidth  = static_cast<SInt32>(Capabilities.MaxTextureDimension);
         PlatformIO.Renderer_TextureMaxHeight = PlatformIO.Renderer_TextureMaxWidth;
@@ -47,6 +160,11 @@ namespace Plugin
 
     void ImGuiRenderer::Dispose()
     {
+        const std::lock_guard Guard(sGraphicsLock);
+
+        ReleaseRetained();
+        ImGuiWorkers::Release();
+
         for (const Ptr<ImTextureData> Texture : ImGui::GetPlatformIO().Textures)
         {
             if (Texture->RefCount == 1)
@@ -54,6 +172,26 @@ namespace Plugin
                 DeleteTexture(Texture);
             }
         }
+
+        // Textures released above were pooled, so they have to be destroyed for real now.
+        TrimPool(0);
+
+        // Destroy the distance field atlas last, since its textures are part of the platform texture list above.
+        if (mDistanceAtlas)
+        {
+            ImGui::UnregisterFontAtlas(mDistanceAtlas);
+            IM_DELETE(mDistanceAtlas);
+
+            mDistanceAtlas = nullptr;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiRenderer::IsReady() const
+    {
+        return mTechnique->HasCompleted() && mTechniqueAlpha->HasCompleted() && mTechniqueSDF->HasCompleted();
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -61,11 +199,17 @@ namespace Plugin
 
     void ImGuiRenderer::Submit(ConstRef<ImDrawData> Commands)
     {
-        // Abort drawing if the technique has not finished loading or compiling.
-        if (!mTechnique->HasCompleted())
-        {
-            return;
-        }
+        mStatistics = Statistics();
+
+        // Serialize calls into the graphics service, while copying and translating geometry below runs unlocked.
+        std::unique_lock Guard(sGraphicsLock);
+
+        // Age retained geometry, pooled textures and promotion candidates.
+        ++mFrame;
+
+        // The commands recorded for the previous frame no longer match the draw data.
+        mRecording.Eligible = false;
+        mRecording.Complete = false;
 
         // Handle all pending texture operations.
         if (Commands.Textures != nullptr)
@@ -75,12 +219,15 @@ namespace Plugin
                 switch (Texture->Status)
                 {
                 case ImTextureStatus_WantCreate:
+                    ++mStatistics.TextureCreates;
                     CreateTexture(Texture);
                     break;
                 case ImTextureStatus_WantUpdates:
+                    ++mStatistics.TextureUpdates;
                     UpdateTexture(Texture);
                     break;
                 case ImTextureStatus_WantDestroy:
+                    ++mStatistics.TextureDeletes;
                     DeleteTexture(Texture);
                     break;
                 default:
@@ -89,155 +236,1254 @@ namespace Plugin
             }
         }
 
-        Graphic::Transient<ImDrawVert> VtxSlice = mGraphics->AllocateTransientVertices<ImDrawVert>(Commands.TotalVtxCount);
-        Graphic::Transient<ImDrawIdx>  IdxSlice = mGraphics->AllocateTransientIndices<ImDrawIdx>(Commands.TotalIdxCount);
+        // Destroy the pooled textures no longer likely to be reused.
+        TrimPool(kPoolBudget);
+
+        // Abort drawing if the techniques have not finished loading or compiling. Textures are still uploaded above,
+        // so the font atlas is already resident and the first drawn frame does not pay for it.
+        if (!IsReady())
+        {
+            return;
+        }
+
+        // Count the commands that survive clipping and merging, so they can be allocated in a single batch, and
+        // record where each draw list starts so lists can be translated independently of each other. Commands are
+        // also counted as if batched across textures, since whether the frame can be batched is only known after.
+        Graphic::Scissor Scissor;
+        UInt32           VtxOffset = 0;
+        UInt32           IdxOffset = 0;
+        UInt32           Total     = 0;
+        UInt32           Batches   = 0;
+        UInt32           Merged    = 0;
+        UInt32           Culled    = 0;
+        Bool             Callbacks = false;
+        Bool             Custom    = false;
+        Slots            Bound;
+
+        mJobs.clear();
+
+        for (const ConstPtr<ImDrawList> CommandList : Commands.CmdLists)
+        {
+            mJobs.push_back({ CommandList, VtxOffset, IdxOffset, Total, Batches });
+
+            ConstPtr<ImDrawCmd> Previous = nullptr;
+
+            for (ConstRef<ImDrawCmd> Command : CommandList->CmdBuffer)
+            {
+                if (Command.UserCallback)
+                {
+                    // State changes are handled while translating, only user code forces serial translation.
+                    if (Command.UserCallback == &ImGuiRenderer::OnMaterial)
+                    {
+                        Custom = true;
+                    }
+                    else if (Command.UserCallback != ImDrawCallback_ResetRenderState)
+                    {
+                        Callbacks = true;
+                    }
+                    Previous = nullptr;
+                }
+                else if (Clip(Commands, Command.ClipRect, Scissor))
+                {
+                    if (!mMaterials.empty() && Command.TexRef._TexData == nullptr)
+                    {
+                        Custom |= GetMaterial(Command.GetTexID()) != nullptr;
+                    }
+
+                    if (Previous && CanMerge(* Previous, Command))
+                    {
+                        ++Merged;
+                    }
+                    else
+                    {
+                        ++Total;
+                    }
+
+                    if (!Previous || !CanBatch(* Previous, Command) || Bound.Bind(Command.GetTexID()) == kBatchSlots)
+                    {
+                        Bound = Slots();
+                        Bound.Bind(Command.GetTexID());
+
+                        ++Batches;
+                    }
+                    Previous = AddressOf(Command);
+                }
+                else
+                {
+                    ++Culled;
+                }
+            }
+
+            VtxOffset += CommandList->VtxBuffer.Size;
+            IdxOffset += CommandList->IdxBuffer.Size;
+        }
+
+        // Keep what re-issuing the frame takes, see \ref Resubmit. Callbacks must run every frame, so they prevent it.
+        mRecording.Eligible = !Callbacks;
+        mRecording.Total    = Total;
+
+        // Batching needs transient geometry to tag vertices with their texture, and cannot honor callbacks or
+        // materials, since those change the technique in the middle of a batch.
+        const Bool Batch = mBatch && !mRetain && !Callbacks && !Custom && mTechniqueBatch->HasCompleted();
+
+        if (Batch)
+        {
+            mStatistics.Batched = Total - Batches;
+
+            Merged += Total - Batches;
+            Total   = Batches;
+        }
+
+        mStatistics.Lists    = Commands.CmdLists.Size;
+        mStatistics.Vertices = Commands.TotalVtxCount;
+        mStatistics.Indices  = Commands.TotalIdxCount;
+        mStatistics.Commands = Total;
+        mStatistics.Merged   = Merged;
+        mStatistics.Culled   = Culled;
+
+        Graphic::Transient<Graphic::Command> GfxSlice = mGraphics->AllocateTransientCommands(Total);
+        Graphic::Transient<Matrix4x4>        UboSlice = mGraphics->AllocateTransientUniforms<Matrix4x4>(1);
 
-        Graphic::Transient<Matrix4x4> UboSlice = mGraphics->AllocateTransientUniforms<Matrix4x4>(1);
-        UboSlice[0] = Matrix4x4::CreateOrthographic(
+        const Matrix4x4 Projection = Matrix4x4::CreateOrthographic(
                 Commands.DisplayPos.x,
                 Commands.DisplayPos.x + Commands.DisplaySize.x,
                 Commands.DisplayPos.y + Commands.DisplaySize.y,
                 Commands.DisplayPos.y,
                 -1.0f,
                 +1.0f);
+        UboSlice[0] = Projection;
 
-        UInt32 VtxOffset = 0;
-        UInt32 IdxOffset = 0;
+        mRecording.Projection = Projection;
 
-        const Bool SupportsVertexBaseOffset = mGraphics->GetDescription().Capabilities.SupportsBaseVertex;
+        const Ptr<Graphic::Command> GfxData = Total > 0 ? AddressOf(GfxSlice[0]) : nullptr;
 
-        for (const ConstPtr<ImDrawList> CommandList : Commands.CmdLists)
+        if (mRetain)
         {
-            VtxSlice.Copy(ConstSpan(CommandList->VtxBuffer.Data, CommandList->VtxBuffer.Size), VtxOffset);
-            IdxSlice.Copy(ConstSpan(CommandList->IdxBuffer.Data, CommandList->IdxBuffer.Size), IdxOffset);
+            mLayouts.clear();
 
-            for (SInt32 Element = 0; Element < CommandList->CmdBuffer.Size; ++Element)
+            for (ConstRef<Job> Job : mJobs)
             {
-                ConstRef<ImDrawCmd> Command = CommandList->CmdBuffer[Element];
+                ConstRef<Retained> Geometry = Upload(Job.CommandList);
 
-                if (Command.UserCallback)
-                {
-                    Command.UserCallback(CommandList, AddressOf(Command));
-                    continue;
-                }
+                mLayouts.push_back(Layout {
+                    .Vertices  = { .Buffer = Geometry.Vertices, .Offset = 0, .Stride = sizeof(ImDrawVert) },
+                    .Indices   = { .Buffer = Geometry.Indices,  .Offset = 0, .Stride = sizeof(ImDrawIdx)  },
+                    .VtxOffset = 0,
+                    .IdxOffset = 0,
+                    .Compact   = false,
+                });
+            }
+
+            ExpireRetained();
+
+            // Building runs the user callbacks, which may submit graphics work of their own, so it happens unlocked.
+            Guard.unlock();
 
-                const Real32 MinX = Max(Command.ClipRect.x - Commands.DisplayPos.x, 0.0f);
-                const Real32 MinY = Max(Command.ClipRect.y - Commands.DisplayPos.y, 0.0f);
-                const Real32 MaxX = Min(Command.ClipRect.z - Commands.DisplayPos.x, Commands.DisplaySize.x);
-                const Real32 MaxY = Min(Command.ClipRect.w - Commands.DisplayPos.y, Commands.DisplaySize.y);
+            for (UInt32 Index = 0; Index < mJobs.size(); ++Index)
+            {
+                ConstRef<Job> Job = mJobs[Index];
+                (this->*mBuildRetained)(
+                    Commands, Job.CommandList, mLayouts[Index], UboSlice.GetStream(), GfxData, Job.GfxOffset);
+            }
+        }
+        else
+        {
+            // Geometry recorded by a replay (see \ref Resubmit) is only released once it expires.
+            ExpireRetained();
+
+            Guard.unlock();
+
+            // Rebased 16-bit indices can only address the first 65536 vertices of the frame, so widen them past that.
+            const Bool Wide = mRebase && sizeof(ImDrawIdx) < sizeof(UInt32)
+                && static_cast<UInt32>(Commands.TotalVtxCount) > std::numeric_limits<UInt16>::max() + 1u;
+
+            // The compact format stores positions relative to the display origin, which the projection accounts for.
+            // It is skipped when callbacks are present, since falling back would run them a second time, and when
+            // materials are used, since their techniques expect the full vertex format. Batched frames carry the
+            // texture slot in every vertex, so they keep the full format as well.
+            Bool Compact = mCompact && !Batch && !Callbacks && !Custom && mTechniqueCompact->HasCompleted()
+                && mTechniqueAlphaCompact->HasCompleted() && mTechniqueSDFCompact->HasCompleted();
+
+            // The bounds of the frame are measured before anything is allocated, so a frame that does not fit the
+            // compact format takes the full format right away.
+            ImGuiKernel::Placement Placement { };
+            Compact = Compact && Fit(Commands, Placement);
 
-                if (MaxX <= MinX || MaxY <= MinY)
+            if (Batch)
+            {
+                using Vertex = ImGuiKernel::BatchedVertex;
+
+                if (Wide)
+                {
+                    Transfer<Vertex, UInt32>(Commands, Placement, UboSlice.GetStream(), GfxData, Callbacks);
+                }
+                else
                 {
-                    continue;
+                    Transfer<Vertex, ImDrawIdx>(Commands, Placement, UboSlice.GetStream(), GfxData, Callbacks);
                 }
+            }
+            else if (Compact)
+            {
+                // Compact positions are fixed point steps around the origin of the placement, in the projection too.
+                const Real32 Left = (Commands.DisplayPos.x - Placement.Origin.x) * Placement.Scale;
+                const Real32 Top  = (Commands.DisplayPos.y - Placement.Origin.y) * Placement.Scale;
 
-                Ref<Graphic::Command> GfxCommand = mGraphics->AllocateTransientCommands(1).GetFront();
+                UboSlice[0] = Matrix4x4::CreateOrthographic(
+                        Left,
+                        Left + Commands.DisplaySize.x * Placement.Scale,
+                        Top  + Commands.DisplaySize.y * Placement.Scale,
+                        Top,
+                        -1.0f,
+                        +1.0f);
 
-                // Devices without base-vertex support ignore vertex base offset.
-                const UInt32    Base     = VtxOffset + Command.VtxOffset;
-                Graphic::Stream Vertices = VtxSlice.GetStream();
+                using Vertex = ImGuiKernel::CompactVertex;
 
-                if (!SupportsVertexBaseOffset)
+                if (Wide)
+                {
+                    Transfer<Vertex, UInt32>(Commands, Placement, UboSlice.GetStream(), GfxData, Callbacks);
+                }
+                else
                 {
-                    Vertices.Offset += Base * sizeof(ImDrawVert);
+                    Transfer<Vertex, ImDrawIdx>(Commands, Placement, UboSlice.GetStream(), GfxData, Callbacks);
                 }
+            }
+            else
+            {
+                if (Wide)
+                {
+                    Transfer<ImDrawVert, UInt32>(Commands, Placement, UboSlice.GetStream(), GfxData, Callbacks);
+                }
+                else
+                {
+                    Transfer<ImDrawVert, ImDrawIdx>(Commands, Placement, UboSlice.GetStream(), GfxData, Callbacks);
+                }
+            }
+        }
+    }
 
-                GfxCommand.Scissor = Graphic::Scissor(
-                    static_cast<UInt16>(MinX),
-                    static_cast<UInt16>(MinY),
-                    static_cast<UInt16>(MaxX - MinX),
-                    static_cast<UInt16>(MaxY - MinY));
-                GfxCommand.Pipeline = mTechnique->GetHandle();
-                GfxCommand.Vertices.Append(Vertices);
-                GfxCommand.Indices = IdxSlice.GetStream();
-                GfxCommand.Uniforms[Enum::Cast(Graphic::UniformScope::Global)] = UboSlice.GetStream();
-                GfxCommand.Textures.Append(static_cast<Graphic::Object>(Command.GetTexID()));
-                GfxCommand.Samplers.Append(Graphic::Sampler());
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-                GfxCommand.Parameters = {
-                    .Count     = Command.ElemCount,
-                    .Base      = SupportsVertexBaseOffset ? static_cast<SInt32>(Base) : 0,
-                    .Offset    = Command.IdxOffset + IdxOffset,
-                    .Instances = 1
+    void ImGuiRenderer::Resubmit(ConstRef<ImDrawData> Commands)
+    {
+        // Frames that were not drawn, or whose callbacks must run every frame, are translated again.
+        if (!mRecording.Eligible)
+        {
+            Submit(Commands);
+            return;
+        }
+
+        mStatistics = Statistics();
+
+        const std::lock_guard Guard(sGraphicsLock);
+
+        ++mFrame;
+
+        // The first replay moves the geometry of the frame to retained buffers and builds its commands against them,
+        // so they stay valid across frames. Further replays only copy the recorded commands.
+        if (!mRecording.Complete)
+        {
+            mRecording.Commands.clear();
+            mRecording.Commands.resize(mRecording.Total);
+
+            for (ConstRef<Job> Job : mJobs)
+            {
+                ConstRef<Retained> Geometry = Upload(Job.CommandList);
+
+                const Layout Layout {
+                    .Vertices  = { .Buffer = Geometry.Vertices, .Offset = 0, .Stride = sizeof(ImDrawVert) },
+                    .Indices   = { .Buffer = Geometry.Indices,  .Offset = 0, .Stride = sizeof(ImDrawIdx)  },
+                    .VtxOffset = 0,
+                    .IdxOffset = 0,
+                    .Compact   = false,
                 };
+
+                // Uniforms live in transient memory, so they are bound again by every replay below.
+                (this->*mBuildRetained)(
+                    Commands, Job.CommandList, Layout, Graphic::Stream(), mRecording.Commands.data(), Job.GfxOffset);
             }
 
-            VtxOffset += CommandList->VtxBuffer.Size;
-            IdxOffset += CommandList->IdxBuffer.Size;
+            ExpireRetained();
+
+            mRecording.Complete = true;
+        }
+
+        Graphic::Transient<Graphic::Command> GfxSlice = mGraphics->AllocateTransientCommands(mRecording.Total);
+        Graphic::Transient<Matrix4x4>        UboSlice = mGraphics->AllocateTransientUniforms<Matrix4x4>(1);
+        UboSlice[0] = mRecording.Projection;
+
+        for (UInt32 Index = 0; Index < mRecording.Total; ++Index)
+        {
+            Ref<Graphic::Command> GfxCommand = GfxSlice[Index];
+            GfxCommand = mRecording.Commands[Index];
+            GfxCommand.Uniforms[Enum::Cast(Graphic::UniformScope::Global)] = UboSlice.GetStream();
         }
+
+        mStatistics.Lists    = Commands.CmdLists.Size;
+        mStatistics.Vertices = Commands.TotalVtxCount;
+        mStatistics.Indices  = Commands.TotalIdxCount;
+        mStatistics.Commands = mRecording.Total;
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void ImGuiRenderer::CreateTexture(Ptr<ImTextureData> Texture)
+    Ptr<ImFont> ImGuiRenderer::AddDistanceFont(ConstSpan<Byte> Data, Real32 Size)
     {
-        const UInt32           Size = Texture->Height * Texture->Width * Texture->BytesPerPixel;
-        Graphic::TextureFormat Format;
-
-        switch (Texture->Format)
+        // Distance field glyphs cannot share a texture with coverage glyphs, so they live in an atlas of their own.
+        if (!mDistanceAtlas)
         {
-        case ImTextureFormat_RGBA32:
-            Format = Graphic::TextureFormat::RGBA8UIntNorm;
-            break;
-        case ImTextureFormat_Alpha8:
-            Format = Graphic::TextureFormat::R8UIntNorm;
-            break;
-        default:
-            ZY_ASSERT(false, "Unsupported ImGui texture format");
-            return;
+            mDistanceAtlas = IM_NEW(ImFontAtlas)();
+            mDistanceAtlas->Flags           |= ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_NoMouseCursors;
+            mDistanceAtlas->TexDesiredFormat = ImTextureFormat_Alpha8;
+            mDistanceAtlas->SetFontLoader(ImGuiDistanceFont::GetLoader());
+
+            ImGui::RegisterFontAtlas(mDistanceAtlas);
         }
 
-        const Graphic::Object Handle = mGraphics->CreateTexture(
-            Graphic::TextureLayout::Texture2D,
-            Format,
-            Graphic::Storage::Stream,
-            Graphic::Usage::Sample,
-            Texture->Width,
-            Texture->Height,
-            1,
-            Graphic::Multisample::X1,
-            Blob::Borrow<Byte>(static_cast<ConstPtr<Byte>>(Texture->GetPixels()), Size));
-        Texture->SetTexID(Handle);
-        Texture->SetStatus(ImTextureStatus_OK);
+        // Lock the font to its reference size, so other sizes scale the reference glyphs instead of baking new ones.
+        ImFontConfig Config;
+        Config.Flags = ImFontFlags_LockBakedSizes;
+
+        const Ptr<void> Copy = IM_ALLOC(Data.size());
+        std::memcpy(Copy, Data.data(), Data.size());
+
+        return mDistanceAtlas->AddFontFromMemoryTTF(Copy, static_cast<SInt32>(Data.size()), Size, AddressOf(Config));
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void ImGuiRenderer::DeleteTexture(Ptr<ImTextureData> Texture)
+    void ImGuiRenderer::SetFontCache(Text Directory)
     {
-        if (const Graphic::Object Handle = Texture->GetTexID(); Handle)
-        {
-            mGraphics->DeleteTexture(Handle);
+        ImGuiFontCache::SetDirectory(Directory);
+        ImGuiFontCache::Apply(ImGui::GetIO().Fonts);
+    }
 
-            // Invalidate texture ID.
-            Texture->SetTexID(ImTextureID_Invalid);
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ImTextureID ImGuiRenderer::Register(Graphic::Object Texture, ConstRef<Material> Material)
+    {
+        const ImTextureID Identifier = static_cast<ImTextureID>(Texture);
+        mMaterials[Identifier] = Material;
+        return Identifier;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::Unregister(ImTextureID Identifier)
+    {
+        mMaterials.erase(Identifier);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::UseMaterial(Ref<ImDrawList> List, ImTextureID Identifier)
+    {
+        // The identifier travels as the callback data itself, so nothing is copied into the draw list.
+        List.AddCallback(&ImGuiRenderer::OnMaterial, reinterpret_cast<Ptr<void>>(static_cast<UInt64>(Identifier)));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::SetParallelThreshold(UInt32 Threshold)
+    {
+        mParallelThreshold = Threshold;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::SetRetain(Bool Retain)
+    {
+        if (mRetain && !Retain)
+        {
+            const std::lock_guard Guard(sGraphicsLock);
+            ReleaseRetained();
         }
-        Texture->SetStatus(ImTextureStatus_Destroyed);
+        mRetain = Retain;
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void ImGuiRenderer::UpdateTexture(Ptr<ImTextureData> Texture)
+    void ImGuiRenderer::Trim()
     {
-        const UInt32 Pitch = Texture->GetPitch();
+        const std::lock_guard Guard(sGraphicsLock);
+        TrimPool(0);
+    }
 
-        for (const auto [X, Y, W, H] : Texture->Updates)
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<ImGuiRenderer::Addressing Mode>
+    void ImGuiRenderer::Build(ConstRef<ImDrawData> Commands, ConstPtr<ImDrawList> CommandList, ConstRef<Layout> Layout,
+        ConstRef<Graphic::Stream> Uniforms, Ptr<Graphic::Command> Output, UInt32 Offset) const
+    {
+        Graphic::Scissor    Scissor;
+        ConstPtr<ImDrawCmd> Previous = nullptr;
+        ConstPtr<Material>  Override = nullptr;
+
+        for (ConstRef<ImDrawCmd> Command : CommandList->CmdBuffer)
         {
-            const UInt32 Size = (H - 1) * Pitch + W * Texture->BytesPerPixel;
+            if (Command.UserCallback)
+            {
+                // Every command carries its whole state, so resetting it only drops the material in use.
+                if (Command.UserCallback == ImDrawCallback_ResetRenderState)
+                {
+                    Override = nullptr;
+                }
+                else if (Command.UserCallback == &ImGuiRenderer::OnMaterial)
+                {
+                    const UInt64 Identifier = reinterpret_cast<UInt64>(Command.UserCallbackData);
+                    Override = GetMaterial(static_cast<ImTextureID>(Identifier));
+                }
+                else
+                {
+                    Command.UserCallback(CommandList, AddressOf(Command));
+                }
 
-            mGraphics->UpdateTexture(
-                Texture->GetTexID(),
-                0,
-                X,
-                Y,
-                W,
-                H,
-                Pitch,
-                Blob::Borrow<Byte>(static_cast<ConstPtr<Byte>>(Texture->GetPixelsAt(X, Y)), Size));
-        }
-        Texture->SetStatus(ImTextureStatus_OK);
+                Previous = nullptr;
+                continue;
+            }
+
+            if (!Clip(Commands, Command.ClipRect, Scissor))
+            {
+                continue;
+            }
+
+            // Extend the previous command when both share state and their index ranges are contiguous.
+            if (Previous && CanMerge(* Previous, Command))
+            {
+                Output[Offset - 1].Parameters.Count += Command.ElemCount;
+
+                Previous = AddressOf(Command);
+                continue;
+            }
+
+            Ref<Graphic::Command> GfxCommand = Output[Offset++];
+
+            // Devices without base-vertex support ignore vertex base offset, and rebased indices already include it.
+            const UInt32    Base     = Layout.VtxOffset + Command.VtxOffset;
+            Graphic::Stream Vertices = Layout.Vertices;
+
+            if constexpr (Mode == Addressing::Offset)
+            {
+                Vertices.Offset += Base * Vertices.Stride;
+            }
+
+            // Registered textures bring their own material, unless the draw list overrides it.
+            ConstPtr<Material> Binding = Override;
+
+            if (Binding == nullptr && Command.TexRef._TexData == nullptr && !mMaterials.empty())
+            {
+                Binding = GetMaterial(Command.GetTexID());
+            }
+
+            const Bool Technique = Binding && Binding->Technique && Binding->Technique->HasCompleted();
+
+            GfxCommand.Scissor  = Scissor;
+            GfxCommand.Pipeline = Technique
+                ? Binding->Technique->GetHandle()
+                : GetPipeline(Command.TexRef._TexData, Layout.Compact);
+            GfxCommand.Vertices.Append(Vertices);
+            GfxCommand.Indices = Layout.Indices;
+            GfxCommand.Uniforms[Enum::Cast(Graphic::UniformScope::Global)] = Uniforms;
+            GfxCommand.Textures.Append(static_cast<Graphic::Object>(Command.GetTexID()));
+            GfxCommand.Samplers.Append(Binding ? Binding->Sampler : Graphic::Sampler());
+
+            GfxCommand.Parameters = {
+                .Count     = Command.ElemCount,
+                .Base      = Mode == Addressing::BaseVertex ? static_cast<SInt32>(Base) : 0,
+                .Offset    = Command.IdxOffset + Layout.IdxOffset,
+                .Instances = 1
+            };
+
+            Previous = AddressOf(Command);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<ImGuiRenderer::Addressing Mode>
+    void ImGuiRenderer::BuildBatched(ConstRef<ImDrawData> Commands, ConstPtr<ImDrawList> CommandList,
+        ConstRef<Layout> Layout, Ptr<ImGuiKernel::BatchedVertex> Vertices, ConstRef<Graphic::Stream> Uniforms,
+        Ptr<Graphic::Command> Output, UInt32 Offset) const
+    {
+        Graphic::Scissor    Scissor;
+        ConstPtr<ImDrawCmd> Previous = nullptr;
+        Slots               Bound;
+
+        // Bind the textures of a finished command, filling the unused slots with its first texture so the technique
+        // never samples an unbound slot.
+        const auto Seal = [&]()
+        {
+            Ref<Graphic::Command> GfxCommand = Output[Offset - 1];
+
+            for (UInt32 Slot = 0; Slot < kBatchSlots; ++Slot)
+            {
+                const ImTextureID Texture = Bound.Textures[Slot < Bound.Count ? Slot : 0];
+
+                GfxCommand.Textures.Append(static_cast<Graphic::Object>(Texture));
+                GfxCommand.Samplers.Append(Graphic::Sampler());
+            }
+        };
+
+        for (ConstRef<ImDrawCmd> Command : CommandList->CmdBuffer)
+        {
+            // Only render state resets reach this point, since batching is disabled for callbacks and materials.
+            if (Command.UserCallback)
+            {
+                Previous = nullptr;
+                continue;
+            }
+
+            if (!Clip(Commands, Command.ClipRect, Scissor))
+            {
+                continue;
+            }
+
+            // Extend the previous command when both share state and their index ranges are contiguous, as long as
+            // the texture is already bound or a slot is still free. This must match the count made in Submit.
+            UInt32 Slot = kBatchSlots;
+
+            if (Previous && CanBatch(* Previous, Command))
+            {
+                Slot = Bound.Bind(Command.GetTexID());
+            }
+
+            if (Slot < kBatchSlots)
+            {
+                Output[Offset - 1].Parameters.Count += Command.ElemCount;
+            }
+            else
+            {
+                if (Bound.Count > 0)
+                {
+                    Seal();
+                }
+
+                Bound = Slots();
+                Slot  = Bound.Bind(Command.GetTexID());
+
+                Ref<Graphic::Command> GfxCommand = Output[Offset++];
+
+                // Rebased indices already include the vertex base, every other device adds it while drawing.
+                const UInt32 Base = Layout.VtxOffset + Command.VtxOffset;
+
+                GfxCommand.Scissor  = Scissor;
+                GfxCommand.Pipeline = mTechniqueBatch->GetHandle();
+                GfxCommand.Vertices.Append(Layout.Vertices);
+                GfxCommand.Indices = Layout.Indices;
+                GfxCommand.Uniforms[Enum::Cast(Graphic::UniformScope::Global)] = Uniforms;
+
+                GfxCommand.Parameters = {
+                    .Count     = Command.ElemCount,
+                    .Base      = Mode == Addressing::BaseVertex ? static_cast<SInt32>(Base) : 0,
+                    .Offset    = Command.IdxOffset + Layout.IdxOffset,
+                    .Instances = 1
+                };
+            }
+
+            // Tag the vertices referenced by the command with its slot and shading, which the technique reads back.
+            const UInt32              Tag     = Slot | Enum::Cast(GetShading(Command.TexRef._TexData)) << 8;
+            const ConstPtr<ImDrawIdx> Indices = CommandList->IdxBuffer.Data + Command.IdxOffset;
+
+            for (UInt32 Element = 0; Element < Command.ElemCount; ++Element)
+            {
+                Vertices[Command.VtxOffset + Indices[Element]].Texture = Tag;
+            }
+
+            Previous = AddressOf(Command);
+        }
+
+        if (Bound.Count > 0)
+        {
+            Seal();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<typename Vertex, typename Index>
+    void ImGuiRenderer::Transfer(ConstRef<ImDrawData> Commands, ConstRef<ImGuiKernel::Placement> Placement,
+        ConstRef<Graphic::Stream> Uniforms, Ptr<Graphic::Command> Output, Bool Callbacks)
+    {
+        constexpr Bool Compact = std::is_same_v<Vertex, ImGuiKernel::CompactVertex>;
+        constexpr Bool Batched = std::is_same_v<Vertex, ImGuiKernel::BatchedVertex>;
+
+        // Every draw list writes to its own range of every slice, so large frames are spread across worker threads.
+        // User callbacks must run on the calling thread and in order, which forces the serial path.
+        const auto Dispatch = [&](auto Function)
+        {
+            if (Callbacks || static_cast<UInt32>(Commands.TotalVtxCount) < mParallelThreshold)
+            {
+                std::for_each(mJobs.begin(), mJobs.end(), Function);
+            }
+            else
+            {
+                ImGuiWorkers::Run(mJobs.size(), [&](UInt32 Position)
+                {
+                    Function(mJobs[Position]);
+                });
+            }
+        };
+
+        // The format is settled before this point, so both slices are allocated in a single critical section.
+        std::unique_lock Guard(sGraphicsLock);
+        Graphic::Transient<Vertex> VtxSlice = mGraphics->AllocateTransientVertices<Vertex>(Commands.TotalVtxCount);
+        Graphic::Transient<Index>  IdxSlice = mGraphics->AllocateTransientIndices<Index>(Commands.TotalIdxCount);
+        Guard.unlock();
+
+        const auto Translate = [&](ConstRef<Job> Job)
+        {
+            const Layout Layout {
+                .Vertices  = VtxSlice.GetStream(),
+                .Indices   = IdxSlice.GetStream(),
+                .VtxOffset = Job.VtxOffset,
+                .IdxOffset = Job.IdxOffset,
+                .Compact   = Compact,
+            };
+
+            ConstRef<ImVector<ImDrawVert>> Vertices = Job.CommandList->VtxBuffer;
+            ConstRef<ImVector<ImDrawIdx>>  Indices  = Job.CommandList->IdxBuffer;
+
+            if constexpr (Batched)
+            {
+                if (Vertices.Size > 0)
+                {
+                    ImGuiKernel::Widen(Vertices.Data, AddressOf(VtxSlice[Job.VtxOffset]), Vertices.Size);
+                }
+            }
+            else if constexpr (Compact)
+            {
+                if (Vertices.Size > 0)
+                {
+                    ImGuiKernel::Pack(Vertices.Data, AddressOf(VtxSlice[Job.VtxOffset]), Vertices.Size, Placement);
+                }
+            }
+            else
+            {
+                VtxSlice.Copy(ConstSpan(Vertices.Data, Vertices.Size), Job.VtxOffset);
+            }
+
+            if (mRebase)
+            {
+                for (ConstRef<ImDrawCmd> Command : Job.CommandList->CmdBuffer)
+                {
+                    if (Command.UserCallback == nullptr && Command.ElemCount > 0)
+                    {
+                        ImGuiKernel::Rebase(
+                            Indices.Data + Command.IdxOffset,
+                            AddressOf(IdxSlice[Job.IdxOffset + Command.IdxOffset]),
+                            Command.ElemCount,
+                            Job.VtxOffset + Command.VtxOffset);
+                    }
+                }
+            }
+            else if constexpr (std::is_same_v<Index, ImDrawIdx>)
+            {
+                IdxSlice.Copy(ConstSpan(Indices.Data, Indices.Size), Job.IdxOffset);
+            }
+
+            if constexpr (Batched)
+            {
+                const Ptr<Vertex> Batch = Vertices.Size > 0 ? AddressOf(VtxSlice[Job.VtxOffset]) : nullptr;
+
+                if (mRebase)
+                {
+                    BuildBatched<Addressing::Rebase>(
+                        Commands, Job.CommandList, Layout, Batch, Uniforms, Output, Job.BatchOffset);
+                }
+                else
+                {
+                    BuildBatched<Addressing::BaseVertex>(
+                        Commands, Job.CommandList, Layout, Batch, Uniforms, Output, Job.BatchOffset);
+                }
+            }
+            else
+            {
+                (this->*mBuild)(Commands, Job.CommandList, Layout, Uniforms, Output, Job.GfxOffset);
+            }
+        };
+
+        Dispatch(Translate);
+
+        mStatistics.Uploaded = Commands.TotalVtxCount * sizeof(Vertex) + Commands.TotalIdxCount * sizeof(Index);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiRenderer::Fit(ConstRef<ImDrawData> Commands, Ref<ImGuiKernel::Placement> Placement)
+    {
+        mBounds.assign(mJobs.size(), ImGuiKernel::Bounds());
+
+        const auto Measure = [&](UInt32 Position)
+        {
+            ConstRef<ImVector<ImDrawVert>> Vertices = mJobs[Position].CommandList->VtxBuffer;
+            ImGuiKernel::Measure(Vertices.Data, Vertices.Size, mBounds[Position]);
+        };
+
+        if (static_cast<UInt32>(Commands.TotalVtxCount) < mParallelThreshold)
+        {
+            for (UInt32 Position = 0; Position < mJobs.size(); ++Position)
+            {
+                Measure(Position);
+            }
+        }
+        else
+        {
+            ImGuiWorkers::Run(mJobs.size(), Measure);
+        }
+
+        ImGuiKernel::Bounds Range;
+
+        for (ConstRef<ImGuiKernel::Bounds> Bounds : mBounds)
+        {
+            for (UInt32 Component = 0; Component < Range.Lower.size(); ++Component)
+            {
+                Range.Lower[Component] = Min(Range.Lower[Component], Bounds.Lower[Component]);
+                Range.Upper[Component] = Max(Range.Upper[Component], Bounds.Upper[Component]);
+            }
+        }
+        return ImGuiKernel::Fit(Range, Placement);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ConstPtr<ImGuiRenderer::Material> ImGuiRenderer::GetMaterial(ImTextureID Identifier) const
+    {
+        const auto Iterator = mMaterials.find(Identifier);
+        return Iterator != mMaterials.end() ? AddressOf(Iterator->second) : nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::OnMaterial(ConstPtr<ImDrawList> List, ConstPtr<ImDrawCmd> Command)
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 ImGuiRenderer::Slots::Bind(ImTextureID Texture)
+    {
+        for (UInt32 Slot = 0; Slot < Count; ++Slot)
+        {
+            if (Textures[Slot] == Texture)
+            {
+                return Slot;
+            }
+        }
+
+        if (Count == kBatchSlots)
+        {
+            return kBatchSlots;
+        }
+        Textures[Count] = Texture;
+        return Count++;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ImGuiRenderer::Shading ImGuiRenderer::GetShading(ConstPtr<ImTextureData> Texture) const
+    {
+        if (Texture == nullptr || Texture->Format != ImTextureFormat_Alpha8)
+        {
+            return Shading::Color;
+        }
+
+        // Single channel textures were classified when they were created.
+        const auto Iterator = mTextures.find(Texture->UniqueID);
+        return Iterator != mTextures.end() ? Iterator->second.Mode : Shading::Coverage;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ImGuiRenderer::Shading ImGuiRenderer::Classify(ConstPtr<ImTextureData> Texture) const
+    {
+        // Atlases keep the format the user asked for, so colored glyphs (e.g. emoji) stay in RGBA textures, drawn
+        // like any image. Single channel textures either hold distance fields or plain coverage.
+        if (Texture->Format != ImTextureFormat_Alpha8)
+        {
+            return Shading::Color;
+        }
+
+        if (mDistanceAtlas)
+        {
+            for (const ConstPtr<ImTextureData> Entry : mDistanceAtlas->TexList)
+            {
+                if (Entry == Texture)
+                {
+                    return Shading::Distance;
+                }
+            }
+        }
+        return Shading::Coverage;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Graphic::Object ImGuiRenderer::GetPipeline(ConstPtr<ImTextureData> Texture, Bool Compact) const
+    {
+        switch (GetShading(Texture))
+        {
+        case Shading::Distance:
+            return (Compact ? mTechniqueSDFCompact : mTechniqueSDF)->GetHandle();
+        case Shading::Coverage:
+            return (Compact ? mTechniqueAlphaCompact : mTechniqueAlpha)->GetHandle();
+        default:
+            return (Compact ? mTechniqueCompact : mTechnique)->GetHandle();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ConstRef<ImGuiRenderer::Retained> ImGuiRenderer::Upload(ConstPtr<ImDrawList> CommandList)
+    {
+        const ConstPtr<Byte> VtxData = reinterpret_cast<ConstPtr<Byte>>(CommandList->VtxBuffer.Data);
+        const UInt32         VtxSize = CommandList->VtxBuffer.size_in_bytes();
+        const ConstPtr<Byte> IdxData = reinterpret_cast<ConstPtr<Byte>>(CommandList->IdxBuffer.Data);
+        const UInt32         IdxSize = CommandList->IdxBuffer.size_in_bytes();
+
+        // Draw lists are identified by their address, which ImGui keeps for as long as the owner window lives. Names
+        // are not unique (e.g. a window and its child lists), and a second upload in the same frame would replace
+        // buffers that commands built for the first list still reference.
+        Ref<Retained> Geometry = mRetained[CommandList];
+        ZY_ASSERT(Geometry.Frame != mFrame, "A draw list was uploaded twice in the same frame");
+
+        Geometry.Frame = mFrame;
+
+        const UInt64 Hash = GetHash(IdxData, IdxSize, GetHash(VtxData, VtxSize, 0));
+
+        // Empty geometry (e.g. a list holding only callbacks) has no buffer, so a matching hash alone is not enough.
+        const Bool Resident = (Geometry.Vertices != 0) == (VtxSize > 0) && (Geometry.Indices != 0) == (IdxSize > 0);
+
+        if (Resident && Geometry.Hash == Hash && Geometry.VtxSize == VtxSize && Geometry.IdxSize == IdxSize)
+        {
+            return Geometry;
+        }
+
+        // Buffers are updated in place while the geometry keeps its size, recreated otherwise, and dropped when empty.
+        const auto Store = [this](Ref<Graphic::Object> Buffer, UInt32 Previous, Graphic::Usage Usage,
+            ConstPtr<Byte> Data, UInt32 Size)
+        {
+            if (Buffer && Size == Previous)
+            {
+                mGraphics->UpdateBuffer(Buffer, 0, Blob::Borrow<Byte>(Data, Size));
+                return;
+            }
+
+            if (Buffer)
+            {
+                mGraphics->DeleteBuffer(Buffer);
+                Buffer = 0;
+            }
+
+            if (Size > 0)
+            {
+                Buffer = mGraphics->CreateBuffer(Usage, Graphic::Storage::Dynamic, Blob::Borrow<Byte>(Data, Size));
+            }
+        };
+
+        Store(Geometry.Vertices, Geometry.VtxSize, Graphic::Usage::Vertex, VtxData, VtxSize);
+        Store(Geometry.Indices,  Geometry.IdxSize, Graphic::Usage::Index,  IdxData, IdxSize);
+
+        Geometry.Hash    = Hash;
+        Geometry.VtxSize = VtxSize;
+        Geometry.IdxSize = IdxSize;
+
+        mStatistics.Uploaded += VtxSize + IdxSize;
+        return Geometry;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::ExpireRetained()
+    {
+        // Release the geometry of draw lists that have not been seen for a while (e.g. closed windows).
+        for (auto Iterator = mRetained.begin(); Iterator != mRetained.end();)
+        {
+            if (ConstRef<Retained> Geometry = Iterator->second; mFrame - Geometry.Frame > kRetainedLifetime)
+            {
+                mGraphics->DeleteBuffer(Geometry.Vertices);
+                mGraphics->DeleteBuffer(Geometry.Indices);
+
+                Iterator = mRetained.erase(Iterator);
+            }
+            else
+            {
+                ++Iterator;
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::ReleaseRetained()
+    {
+        // Recorded commands reference the buffers released below.
+        mRecording.Complete = false;
+
+        for (const auto & [Key, Geometry] : mRetained)
+        {
+            mGraphics->DeleteBuffer(Geometry.Vertices);
+            mGraphics->DeleteBuffer(Geometry.Indices);
+        }
+        mRetained.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::CreateTexture(Ptr<ImTextureData> Texture)
+    {
+        Graphic::Object Handle    = AcquireTexture(Texture);
+        Bool            Immutable = false;
+
+        // Font atlases receive glyphs as they are needed, every other texture (e.g. user images) is most likely
+        // written once, so it goes straight to immutable storage and is only moved out of it if it ever changes.
+        if (!Handle)
+        {
+            Immutable = !IsAtlas(Texture);
+            Handle    = AllocateTexture(Texture, Immutable ? Graphic::Storage::Immutable : Graphic::Storage::Stream);
+        }
+
+        if (Handle)
+        {
+            mTextures[Texture->UniqueID] = { .Immutable = Immutable, .Mode = Classify(Texture) };
+
+            Texture->SetTexID(Handle);
+            Texture->SetStatus(ImTextureStatus_OK);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::DeleteTexture(Ptr<ImTextureData> Texture)
+    {
+        if (const Graphic::Object Handle = Texture->GetTexID(); Handle)
+        {
+            // Streamed textures are kept for reuse (e.g. by the next atlas of the same size), immutable ones cannot
+            // receive new contents and are destroyed right away.
+            const auto Iterator = mTextures.find(Texture->UniqueID);
+
+            if (Iterator != mTextures.end() && !Iterator->second.Immutable)
+            {
+                ReleaseTexture(Texture, Handle);
+            }
+            else
+            {
+                mGraphics->DeleteTexture(Handle);
+            }
+
+            // Invalidate texture ID.
+            Texture->SetTexID(ImTextureID_Invalid);
+        }
+        mTextures.erase(Texture->UniqueID);
+
+        Texture->SetStatus(ImTextureStatus_Destroyed);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::UpdateTexture(Ptr<ImTextureData> Texture)
+    {
+        Ref<Residency> State = mTextures[Texture->UniqueID];
+
+        // Immutable textures cannot be updated in place, so they are recreated as streamed textures instead, once.
+        if (State.Immutable)
+        {
+            Graphic::Object Handle = AcquireTexture(Texture);
+
+            if (!Handle)
+            {
+                Handle = AllocateTexture(Texture, Graphic::Storage::Stream);
+            }
+
+            if (Handle)
+            {
+                mGraphics->DeleteTexture(Texture->GetTexID());
+
+                State.Immutable = false;
+                Texture->SetTexID(Handle);
+            }
+            Texture->SetStatus(ImTextureStatus_OK);
+            return;
+        }
+
+        // Fall back to a single full upload once most of the texture is dirty.
+        UInt32 Dirty = 0;
+
+        for (const auto [X, Y, W, H] : Texture->Updates)
+        {
+            Dirty += W * H;
+        }
+
+        mRectangles.clear();
+
+        if (Dirty * kUploadFullRatio >= static_cast<UInt32>(Texture->Width * Texture->Height))
+        {
+            mRectangles.push_back({ 0, 0, static_cast<UInt16>(Texture->Width), static_cast<UInt16>(Texture->Height) });
+        }
+        else
+        {
+            mRectangles.assign(Texture->Updates.begin(), Texture->Updates.end());
+
+            Coalesce(mRectangles, Texture->BytesPerPixel);
+        }
+
+        for (const auto [X, Y, W, H] : mRectangles)
+        {
+            mGraphics->UpdateTexture(
+                Texture->GetTexID(), 0, X, Y, W, H, Texture->GetPitch(), BorrowTexture(Texture, X, Y, W, H));
+
+            ++mStatistics.TextureUploads;
+            mStatistics.TextureBytes += W * H * Texture->BytesPerPixel;
+        }
+        Texture->SetStatus(ImTextureStatus_OK);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiRenderer::IsAtlas(ConstPtr<ImTextureData> Texture) const
+    {
+        for (ConstPtr<ImFontAtlas> Atlas : ImGui::GetCurrentContext()->FontAtlases)
+        {
+            if (Atlas->TexData == Texture)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Graphic::Object ImGuiRenderer::AcquireTexture(Ptr<ImTextureData> Texture)
+    {
+        const auto Iterator = mPool.find(GetPoolKey(Texture));
+
+        if (Iterator == mPool.end())
+        {
+            return 0;
+        }
+
+        // Reuse the most recently released texture, leaving the older ones to expire.
+        const Pooled Entry = Iterator->second.back();
+        Iterator->second.pop_back();
+
+        if (Iterator->second.empty())
+        {
+            mPool.erase(Iterator);
+        }
+        mPoolBytes -= Entry.Size;
+
+        const UInt32 Width  = Texture->Width;
+        const UInt32 Height = Texture->Height;
+
+        mGraphics->UpdateTexture(
+            Entry.Handle, 0, 0, 0, Width, Height, Texture->GetPitch(), BorrowTexture(Texture, 0, 0, Width, Height));
+
+        ++mStatistics.TextureRecycles;
+        ++mStatistics.TextureUploads;
+        mStatistics.TextureBytes += Texture->GetSizeInBytes();
+        return Entry.Handle;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::ReleaseTexture(ConstPtr<ImTextureData> Texture, Graphic::Object Handle)
+    {
+        const UInt32 Size = Texture->Width * Texture->Height * Texture->BytesPerPixel;
+
+        if (Size > kPoolBudget)
+        {
+            mGraphics->DeleteTexture(Handle);
+            return;
+        }
+
+        mPool[GetPoolKey(Texture)].push_back({ .Handle = Handle, .Size = Size, .Frame = mFrame });
+        mPoolBytes += Size;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::TrimPool(UInt32 Budget)
+    {
+        // Every bucket is ordered from the oldest to the most recently released texture, so expired textures are
+        // always at the front of their bucket.
+        while (!mPool.empty())
+        {
+            auto Oldest = mPool.begin();
+
+            for (auto Iterator = mPool.begin(); Iterator != mPool.end(); ++Iterator)
+            {
+                if (Iterator->second.front().Frame < Oldest->second.front().Frame)
+                {
+                    Oldest = Iterator;
+                }
+            }
+
+            ConstRef<Pooled> Entry = Oldest->second.front();
+
+            if (mPoolBytes <= Budget && mFrame - Entry.Frame <= kPoolLifetime)
+            {
+                break;
+            }
+
+            mGraphics->DeleteTexture(Entry.Handle);
+            mPoolBytes -= Entry.Size;
+
+            Oldest->second.erase(Oldest->second.begin());
+
+            if (Oldest->second.empty())
+            {
+                mPool.erase(Oldest);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Graphic::Object ImGuiRenderer::AllocateTexture(Ptr<ImTextureData> Texture, Graphic::Storage Storage)
+    {
+        Graphic::TextureFormat Format;
+
+        switch (Texture->Format)
+        {
+        case ImTextureFormat_RGBA32:
+            Format = Graphic::TextureFormat::RGBA8UIntNorm;
+            break;
+        case ImTextureFormat_Alpha8:
+            Format = Graphic::TextureFormat::R8UIntNorm;
+            break;
+        default:
+            ZY_ASSERT(false, "Unsupported ImGui texture format");
+            return 0;
+        }
+
+        const Graphic::Object Handle = mGraphics->CreateTexture(
+            Graphic::TextureLayout::Texture2D,
+            Format,
+            Storage,
+            Graphic::Usage::Sample,
+            Texture->Width,
+            Texture->Height,
+            1,
+            Graphic::Multisample::X1,
+            BorrowTexture(Texture, 0, 0, Texture->Width, Texture->Height));
+
+        ++mStatistics.TextureUploads;
+        mStatistics.TextureBytes += Texture->GetSizeInBytes();
+        return Handle;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Blob ImGuiRenderer::BorrowTexture(Ptr<ImTextureData> Texture, UInt32 X, UInt32 Y, UInt32 Width, UInt32 Height)
+    {
+        // Uploads are synchronous: the graphics service copies the pixels before the call that receives them returns,
+        // on the submitting thread. ImGui's memory is therefore handed over as is, and ImGui may modify it right after.
+        // There is no staging ring, since the service exposes no fence telling when a frame in flight is done.
+        const ConstPtr<Byte> Source = static_cast<ConstPtr<Byte>>(Texture->GetPixelsAt(X, Y));
+        return Blob::Borrow<Byte>(Source, (Height - 1) * Texture->GetPitch() + Width * Texture->BytesPerPixel);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiRenderer::Coalesce(Ref<Vector<ImTextureRect>> Rectangles, UInt32 BytesPerPixel)
+    {
+        const auto GetArea = [](UInt32 MinX, UInt32 MinY, UInt32 MaxX, UInt32 MaxY)
+        {
+            return (MaxX > MinX && MaxY > MinY) ? (MaxX - MinX) * (MaxY - MinY) : 0u;
+        };
+
+        // Greedily merge the pair of rectangles whose union wastes the fewest bytes, for as long as the bytes
+        // uploaded in excess cost less than the upload call being saved.
+        for (Bool Merged = true; Merged && Rectangles.size() > 1;)
+        {
+            SInt64 BestCost = 0;
+            UInt32 BestA    = 0;
+            UInt32 BestB    = 0;
+
+            for (UInt32 A = 0; A < Rectangles.size(); ++A)
+            {
+                ConstRef<ImTextureRect> First = Rectangles[A];
+
+                for (UInt32 B = A + 1; B < Rectangles.size(); ++B)
+                {
+                    ConstRef<ImTextureRect> Second = Rectangles[B];
+
+                    const UInt32 Union = GetArea(
+                        Min(First.x, Second.x),
+                        Min(First.y, Second.y),
+                        Max(First.x + First.w, Second.x + Second.w),
+                        Max(First.y + First.h, Second.y + Second.h));
+                    const UInt32 Overlap = GetArea(
+                        Max(First.x, Second.x),
+                        Max(First.y, Second.y),
+                        Min(First.x + First.w, Second.x + Second.w),
+                        Min(First.y + First.h, Second.y + Second.h));
+                    const UInt32 Covered = First.w * First.h + Second.w * Second.h - Overlap;
+
+                    const SInt64 Cost = static_cast<SInt64>(Union - Covered) * BytesPerPixel - kUploadCallCost;
+
+                    if (Cost < BestCost)
+                    {
+                        BestCost = Cost;
+                        BestA    = A;
+                        BestB    = B;
+                    }
+                }
+            }
+
+            Merged = (BestCost < 0);
+
+            if (Merged)
+            {
+                Ref<ImTextureRect>      First  = Rectangles[BestA];
+                ConstRef<ImTextureRect> Second = Rectangles[BestB];
+
+                const UInt32 MinX = Min(First.x, Second.x);
+                const UInt32 MinY = Min(First.y, Second.y);
+                const UInt32 MaxX = Max(First.x + First.w, Second.x + Second.w);
+                const UInt32 MaxY = Max(First.y + First.h, Second.y + Second.h);
+
+                First = {
+                    static_cast<UInt16>(MinX),
+                    static_cast<UInt16>(MinY),
+                    static_cast<UInt16>(MaxX - MinX),
+                    static_cast<UInt16>(MaxY - MinY)
+                };
+
+                Rectangles[BestB] = Rectangles.back();
+                Rectangles.pop_back();
+            }
+        }
     }
 }
\ No newline at end of file
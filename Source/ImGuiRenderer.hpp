@@ -12,8 +12,10 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "ImGuiKernel.hpp"
 #include <imgui.h>
 #include <Zyphryon.Graphic/Technique.hpp>
+#include <Zyphryon.Math/Matrix4x4.hpp>
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -24,6 +26,67 @@ namespace Plugin
     /// \brief Handles rendering of ImGui draw data using the engine graphics service.
     class ImGuiRenderer final
     {
+    public:
+
+        /// \brief Counters gathered while submitting the last frame.
+        struct Statistics
+        {
+            /// Number of draw lists submitted.
+            UInt32 Lists    = 0;
+
+            /// Number of vertices submitted.
+            UInt32 Vertices = 0;
+
+            /// Number of indices submitted.
+            UInt32 Indices  = 0;
+
+            /// Number of graphic commands emitted.
+            UInt32 Commands = 0;
+
+            /// Number of ImGui commands discarded because their clip rectangle lies outside the display.
+            UInt32 Culled   = 0;
+
+            /// Number of ImGui commands folded into a previous graphic command.
+            UInt32 Merged   = 0;
+
+            /// Number of merged ImGui commands that sample a different texture than the command they were folded into.
+            UInt32 Batched  = 0;
+
+            /// Number of geometry bytes uploaded to the device.
+            UInt32 Uploaded = 0;
+
+            /// Number of textures created.
+            UInt32 TextureCreates = 0;
+
+            /// Number of textures updated.
+            UInt32 TextureUpdates = 0;
+
+            /// Number of textures destroyed.
+            UInt32 TextureDeletes = 0;
+
+            /// Number of textures created by reusing a pooled device texture instead of allocating one.
+            UInt32 TextureRecycles = 0;
+
+            /// Number of texture upload calls issued.
+            UInt32 TextureUploads = 0;
+
+            /// Number of texture bytes uploaded to the device.
+            UInt32 TextureBytes   = 0;
+        };
+
+        /// \brief Describes how the commands sampling a registered texture are drawn.
+        struct Material
+        {
+            /// Technique drawing the commands, or empty to use the default one. It receives the full vertex format.
+            Retainer<Graphic::Technique> Technique;
+
+            /// Sampler reading the texture (e.g. point filtering for pixel accurate previews).
+            Graphic::Sampler             Sampler;
+        };
+
+        /// Number of textures a single batched draw call samples from, see \ref SetBatch.
+        static constexpr UInt32 kBatchSlots = 8;
+
     public:
 
         /// Initializes the ImGui renderer with the specified host.
@@ -34,13 +97,367 @@ namespace Plugin
         /// Disposes of the renderer and releases all associated resources.
         void Dispose();
 
+        /// Checks whether the techniques used to draw the UI have finished loading and compiling.
+        ///
+        /// Techniques are loaded in the background from \ref Initialize. Until they are ready, \ref Submit only
+        /// processes texture operations and draws nothing.
+        ///
+        /// \return `true` if frames are drawn, `false` otherwise.
+        Bool IsReady() const;
+
         /// Submits ImGui draw commands for rendering.
         ///
         /// \param Commands The ImGui draw data containing all commands to be rendered.
         void Submit(ConstRef<ImDrawData> Commands);
 
+        /// Draws the last submitted frame again, without translating its draw data.
+        ///
+        /// The first call after \ref Submit moves the frame's geometry to retained buffers and records its graphic
+        /// commands, so every further call only copies them. Frames with user callbacks are submitted again instead,
+        /// since their callbacks must run every frame.
+        ///
+        /// \param Commands The ImGui draw data last given to \ref Submit, unchanged since.
+        void Resubmit(ConstRef<ImDrawData> Commands);
+
+        /// Adds a font whose glyphs are baked once as signed distance fields and drawn sharp at any size.
+        ///
+        /// \param Data The contents of the TrueType font file, which are copied.
+        /// \param Size The reference size in pixels the glyphs are baked at.
+        /// \return The font, or `nullptr` if it could not be loaded.
+        Ptr<ImFont> AddDistanceFont(ConstSpan<Byte> Data, Real32 Size);
+
+        /// Sets the directory where baked glyphs are cached, so later runs skip baking them again.
+        ///
+        /// Must be called before the fonts are added, with the context of the renderer current. Changing a font or its
+        /// settings invalidates its cache file.
+        ///
+        /// \param Directory The existing directory used to store cache files, or empty to disable the cache.
+        void SetFontCache(Text Directory);
+
+        /// Registers an engine texture (e.g. the color or depth attachment of a render target) for use with ImGui.
+        ///
+        /// The texture is sampled in place, without copies. Must not be called while a frame is being submitted.
+        ///
+        /// \param Texture  The handle of the texture.
+        /// \param Material The technique and sampler used to draw the texture.
+        /// \return The identifier to pass to ImGui (e.g. `ImGui::Image`).
+        ImTextureID Register(Graphic::Object Texture, ConstRef<Material> Material);
+
+        /// Forgets the material of a texture registered with \ref Register.
+        ///
+        /// \param Identifier The identifier returned by \ref Register.
+        void Unregister(ImTextureID Identifier);
+
+        /// Draws the following commands of a draw list with the material of a registered texture, whatever texture
+        /// they sample, until `ImDrawCallback_ResetRenderState` is added to the draw list.
+        ///
+        /// \param List       The draw list to add the state change to.
+        /// \param Identifier The identifier returned by \ref Register.
+        static void UseMaterial(Ref<ImDrawList> List, ImTextureID Identifier);
+
+        /// Sets the number of vertices above which draw lists are copied and translated on worker threads.
+        ///
+        /// \param Threshold The minimum number of vertices in a frame to enable the parallel path.
+        void SetParallelThreshold(UInt32 Threshold);
+
+        /// Enables or disables retained geometry.
+        ///
+        /// When enabled, every draw list keeps its own device buffers and only re-uploads them when
+        /// the hash of its vertices and indices changes, instead of copying all geometry every frame.
+        ///
+        /// \param Retain `true` to keep geometry on the device between frames, `false` otherwise.
+        void SetRetain(Bool Retain);
+
+        /// Enables or disables the compact vertex format.
+        ///
+        /// When enabled, transient vertices are packed into 12 bytes instead of 20 while copied. Positions keep
+        /// 3 fractional bits while the frame spans up to 8192 pixels, and less precision on wider frames. Frames that
+        /// do not fit the compact format (e.g. tiled images, or geometry spanning over 65536 pixels) use the full
+        /// format instead.
+        ///
+        /// \param Compact `true` to pack transient vertices, `false` otherwise.
+        void SetCompact(Bool Compact)
+        {
+            mCompact = Compact;
+        }
+
+        /// Enables or disables texture batching.
+        ///
+        /// When enabled, consecutive commands sharing a clip rectangle are drawn together even if they sample different
+        /// textures, binding up to \ref kBatchSlots textures per draw call and tagging every vertex with its slot.
+        /// Frames using retained geometry, user callbacks or materials are drawn one texture per draw call instead.
+        ///
+        /// \param Batch `true` to batch commands across textures, `false` otherwise.
+        void SetBatch(Bool Batch)
+        {
+            mBatch = Batch;
+        }
+
+        /// Destroys every device texture kept for reuse, e.g. when the device runs low on memory.
+        void Trim();
+
+        /// Retrieves the counters gathered while submitting the last frame.
+        ///
+        /// \return The statistics of the last submission.
+        ConstRef<Statistics> GetStatistics() const
+        {
+            return mStatistics;
+        }
+
+        /// Merges overlapping and nearby dirty rectangles whenever the bytes wasted cost less than the calls saved.
+        ///
+        /// \param Rectangles    The dirty rectangles to merge in place.
+        /// \param BytesPerPixel The number of bytes per pixel of the texture.
+        static void Coalesce(Ref<Vector<ImTextureRect>> Rectangles, UInt32 BytesPerPixel);
+
     private:
 
+        /// \brief Describes where the geometry of a draw list lives on the device.
+        struct Layout
+        {
+            /// Vertex stream holding the draw list's vertices.
+            Graphic::Stream Vertices;
+
+            /// Index stream holding the draw list's indices.
+            Graphic::Stream Indices;
+
+            /// Offset of the draw list's first vertex within the vertex stream.
+            UInt32          VtxOffset;
+
+            /// Offset of the draw list's first index within the index stream.
+            UInt32          IdxOffset;
+
+            /// Whether the vertices are stored in the compact format.
+            Bool            Compact;
+        };
+
+        /// \brief Describes how the contents of a texture are turned into color.
+        enum class Shading : UInt8
+        {
+            Color,    ///< The texture holds colors, modulated by the vertex color.
+            Coverage, ///< The texture holds coverage in a single channel.
+            Distance, ///< The texture holds signed distance fields in a single channel.
+        };
+
+        /// \brief Textures bound to the slots of a batched graphic command.
+        struct Slots
+        {
+            /// Identifiers of the bound textures, in slot order.
+            Array<ImTextureID, kBatchSlots> Textures;
+
+            /// Number of slots in use.
+            UInt32                          Count = 0;
+
+            /// Finds the slot a texture is bound to, binding it to the next free slot if needed.
+            ///
+            /// \param Texture The texture identifier.
+            /// \return The slot of the texture, or \ref kBatchSlots if every slot is taken by other textures.
+            UInt32 Bind(ImTextureID Texture);
+        };
+
+        /// \brief Describes how commands address vertices within a shared vertex stream.
+        enum class Addressing : UInt8
+        {
+            BaseVertex, ///< The device adds the vertex base to every index.
+            Offset,     ///< The vertex stream is offset to the command's first vertex.
+            Rebase,     ///< The vertex base was added to the indices while copying them.
+        };
+
+        /// \brief Signature of the command translation specialized for the device.
+        using BuildFunction = void (ImGuiRenderer::*)(ConstRef<ImDrawData>, ConstPtr<ImDrawList>, ConstRef<Layout>,
+            ConstRef<Graphic::Stream>, Ptr<Graphic::Command>, UInt32) const;
+
+        /// \brief Describes where a draw list starts within the frame's vertices, indices and commands.
+        struct Job
+        {
+            /// The draw list to translate.
+            ConstPtr<ImDrawList> CommandList;
+
+            /// Offset of the draw list's first vertex within the frame.
+            UInt32               VtxOffset;
+
+            /// Offset of the draw list's first index within the frame.
+            UInt32               IdxOffset;
+
+            /// Offset of the draw list's first graphic command within the frame.
+            UInt32               GfxOffset;
+
+            /// Offset of the draw list's first graphic command within the frame when commands are batched.
+            UInt32               BatchOffset;
+        };
+
+        /// \brief Device geometry kept for a single draw list in retained mode.
+        struct Retained
+        {
+            /// Handle of the vertex buffer.
+            Graphic::Object Vertices = 0;
+
+            /// Handle of the index buffer.
+            Graphic::Object Indices  = 0;
+
+            /// Size in bytes of the vertex buffer.
+            UInt32          VtxSize  = 0;
+
+            /// Size in bytes of the index buffer.
+            UInt32          IdxSize  = 0;
+
+            /// Hash of the uploaded vertices and indices.
+            UInt64          Hash     = 0;
+
+            /// Last frame in which the draw list was submitted.
+            UInt32          Frame    = 0;
+        };
+
+        /// \brief Graphic commands of the last submitted frame, kept to draw it again, see \ref Resubmit.
+        struct Recording
+        {
+            /// Whether the last submitted frame can be recorded, which excludes frames with user callbacks.
+            Bool                     Eligible = false;
+
+            /// Whether the commands below were built for the last submitted frame.
+            Bool                     Complete = false;
+
+            /// Number of graphic commands of the frame, when built against retained geometry.
+            UInt32                   Total    = 0;
+
+            /// Projection of the frame.
+            Matrix4x4                Projection;
+
+            /// Graphic commands of the frame, built against retained geometry and without uniforms.
+            Vector<Graphic::Command> Commands;
+        };
+
+        /// \brief Tracks where a texture lives on the device and how it is drawn.
+        struct Residency
+        {
+            /// Whether the texture lives in immutable storage, which it leaves on its first update.
+            Bool    Immutable = false;
+
+            /// How the contents of the texture are turned into color.
+            Shading Mode      = Shading::Color;
+        };
+
+        /// \brief Device texture released by ImGui and kept for reuse by a texture of the same size and format.
+        struct Pooled
+        {
+            /// Handle of the device texture.
+            Graphic::Object Handle = 0;
+
+            /// Size in bytes of the device texture.
+            UInt32          Size   = 0;
+
+            /// Frame in which the texture was released.
+            UInt32          Frame  = 0;
+        };
+
+        /// Number of frames a retained draw list may go unused before its buffers are released.
+        static constexpr UInt32 kRetainedLifetime = 120;
+
+        /// Estimated cost of a texture upload call, expressed in bytes, used to decide when to merge dirty rectangles.
+        static constexpr SInt64 kUploadCallCost   = 4096;
+
+        /// Inverse of the dirty fraction of a texture above which it is uploaded as a whole.
+        static constexpr UInt32 kUploadFullRatio  = 2;
+
+        /// Number of frames a pooled texture is kept without being reused before it is destroyed.
+        static constexpr UInt32 kPoolLifetime     = 600;
+
+        /// Size in bytes the pooled textures may add up to before the oldest ones are destroyed.
+        static constexpr UInt32 kPoolBudget       = 64 * 1024 * 1024;
+
+    private:
+
+        /// Translates the commands of a single draw list into graphic commands.
+        ///
+        /// \tparam Mode       How the commands address the draw list's vertices.
+        ///
+        /// \param Commands    The ImGui draw data the draw list belongs to.
+        /// \param CommandList The draw list to translate.
+        /// \param Layout      The location of the draw list's geometry on the device.
+        /// \param Uniforms    The stream holding the global uniforms.
+        /// \param Output      The graphic commands of the frame to write into.
+        /// \param Offset      The index of the draw list's first command in the batch.
+        template<Addressing Mode>
+        void Build(ConstRef<ImDrawData> Commands, ConstPtr<ImDrawList> CommandList, ConstRef<Layout> Layout,
+            ConstRef<Graphic::Stream> Uniforms, Ptr<Graphic::Command> Output, UInt32 Offset) const;
+
+        /// Translates the commands of a single draw list into graphic commands that sample several textures each.
+        ///
+        /// \tparam Mode       How the commands address the draw list's vertices.
+        ///
+        /// \param Commands    The ImGui draw data the draw list belongs to.
+        /// \param CommandList The draw list to translate.
+        /// \param Layout      The location of the draw list's geometry on the device.
+        /// \param Vertices    The draw list's vertices on the device, tagged with the slot of the texture they sample.
+        /// \param Uniforms    The stream holding the global uniforms.
+        /// \param Output      The graphic commands of the frame to write into.
+        /// \param Offset      The index of the draw list's first command in the batch.
+        template<Addressing Mode>
+        void BuildBatched(ConstRef<ImDrawData> Commands, ConstPtr<ImDrawList> CommandList, ConstRef<Layout> Layout,
+            Ptr<ImGuiKernel::BatchedVertex> Vertices, ConstRef<Graphic::Stream> Uniforms,
+            Ptr<Graphic::Command> Output, UInt32 Offset) const;
+
+        /// Copies the geometry of every draw list into transient memory and translates their commands.
+        ///
+        /// \tparam Vertex   The type of the vertices written to the device.
+        /// \tparam Index    The type of the indices written to the device.
+        ///
+        /// \param Commands  The ImGui draw data to transfer.
+        /// \param Placement The placement of compact vertices, as picked by \ref Fit, ignored by other formats.
+        /// \param Uniforms  The stream holding the global uniforms.
+        /// \param Output    The graphic commands of the frame to write into.
+        /// \param Callbacks Whether any draw list contains user callbacks, which forces serial translation.
+        template<typename Vertex, typename Index>
+        void Transfer(ConstRef<ImDrawData> Commands, ConstRef<ImGuiKernel::Placement> Placement,
+            ConstRef<Graphic::Stream> Uniforms, Ptr<Graphic::Command> Output, Bool Callbacks);
+
+        /// Measures the geometry of every draw list and picks the placement of the frame's compact vertices.
+        ///
+        /// \param Commands  The ImGui draw data to measure.
+        /// \param Placement The placement of the frame's compact vertices.
+        /// \return `true` if the frame fits the compact format, `false` otherwise.
+        Bool Fit(ConstRef<ImDrawData> Commands, Ref<ImGuiKernel::Placement> Placement);
+
+        /// Retrieves how the contents of a texture are turned into color, as classified when it was created.
+        ///
+        /// \param Texture The texture data sampled by the command, or `nullptr` for user textures.
+        /// \return How the texture's contents are turned into color.
+        Shading GetShading(ConstPtr<ImTextureData> Texture) const;
+
+        /// Classifies the contents of a texture from its format and the atlas it belongs to.
+        ///
+        /// \param Texture The texture data to classify.
+        /// \return How the texture's contents are turned into color.
+        Shading Classify(ConstPtr<ImTextureData> Texture) const;
+
+        /// Selects the pipeline used to draw with the given texture.
+        ///
+        /// \param Texture The texture data sampled by the command, or `nullptr` for user textures.
+        /// \param Compact Whether the command's vertices are stored in the compact format.
+        /// \return The handle of the pipeline matching the texture's contents and the vertex format.
+        Graphic::Object GetPipeline(ConstPtr<ImTextureData> Texture, Bool Compact) const;
+
+        /// Retrieves the material registered for a texture identifier.
+        ///
+        /// \param Identifier The texture identifier.
+        /// \return The material of the texture, or `nullptr` if it has none.
+        ConstPtr<Material> GetMaterial(ImTextureID Identifier) const;
+
+        /// Marks the commands following it as drawn with a material, see \ref UseMaterial. Never invoked.
+        static void OnMaterial(ConstPtr<ImDrawList> List, ConstPtr<ImDrawCmd> Command);
+
+        /// Uploads the geometry of a draw list to its retained buffers if it changed since the last upload.
+        ///
+        /// \param CommandList The draw list whose geometry to upload.
+        /// \return The retained geometry of the draw list.
+        ConstRef<Retained> Upload(ConstPtr<ImDrawList> CommandList);
+
+        /// Releases the retained geometry of draw lists not submitted for \ref kRetainedLifetime frames.
+        void ExpireRetained();
+
+        /// Releases all retained geometry.
+        void ReleaseRetained();
+
         /// Creates a texture resource for ImGui rendering.
         ///
         /// \param Texture The texture data to be created.
@@ -56,6 +473,48 @@ namespace Plugin
         /// \param Texture The texture data to be updated.
         void UpdateTexture(Ptr<ImTextureData> Texture);
 
+        /// Checks whether a texture is the current texture of a font atlas, which receives glyphs as they are needed.
+        ///
+        /// \param Texture The texture data to check.
+        /// \return `true` if the texture belongs to a font atlas, `false` otherwise.
+        Bool IsAtlas(ConstPtr<ImTextureData> Texture) const;
+
+        /// Reuses a pooled device texture of the same size and format, and uploads the texture's pixels into it.
+        ///
+        /// \param Texture The texture data to be created.
+        /// \return The handle of the device texture, or `0` if none was pooled.
+        Graphic::Object AcquireTexture(Ptr<ImTextureData> Texture);
+
+        /// Keeps a streamed device texture for reuse instead of destroying it.
+        ///
+        /// \param Texture The texture data the device texture was created for.
+        /// \param Handle  The handle of the device texture.
+        void ReleaseTexture(ConstPtr<ImTextureData> Texture, Graphic::Object Handle);
+
+        /// Destroys the pooled textures kept for too long, then the oldest ones until the pool fits a budget.
+        ///
+        /// \param Budget The size in bytes the pooled textures may add up to.
+        void TrimPool(UInt32 Budget);
+
+        /// Creates a device texture holding the current pixels of an ImGui texture.
+        ///
+        /// \param Texture The texture data to be created.
+        /// \param Storage The storage of the device texture.
+        /// \return The handle of the device texture, or `0` if the format is not supported.
+        Graphic::Object AllocateTexture(Ptr<ImTextureData> Texture, Graphic::Storage Storage);
+
+        /// Hands a region of a texture's pixels to the graphics service, without copying them.
+        ///
+        /// Texture uploads are synchronous and read ImGui's memory on the submitting thread, nothing is staged.
+        ///
+        /// \param Texture The texture data to read from.
+        /// \param X       The horizontal offset of the region.
+        /// \param Y       The vertical offset of the region.
+        /// \param Width   The width of the region.
+        /// \param Height  The height of the region.
+        /// \return The pixels of the region, laid out with the pitch of the texture.
+        Blob BorrowTexture(Ptr<ImTextureData> Texture, UInt32 X, UInt32 Y, UInt32 Width, UInt32 Height);
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -63,5 +522,31 @@ namespace Plugin
 
         Retainer<Graphic::Service>   mGraphics;
         Retainer<Graphic::Technique> mTechnique;
+        Retainer<Graphic::Technique> mTechniqueAlpha;
+        Retainer<Graphic::Technique> mTechniqueSDF;
+        Retainer<Graphic::Technique> mTechniqueCompact;
+        Retainer<Graphic::Technique> mTechniqueAlphaCompact;
+        Retainer<Graphic::Technique> mTechniqueSDFCompact;
+        Retainer<Graphic::Technique> mTechniqueBatch;
+        Ptr<ImFontAtlas>             mDistanceAtlas      = nullptr;
+        Statistics                   mStatistics;
+        BuildFunction                mBuild              = nullptr;
+        BuildFunction                mBuildRetained      = nullptr;
+        Bool                         mRebase             = false;
+        Bool                         mRetain             = false;
+        Bool                         mCompact            = false;
+        Bool                         mBatch              = false;
+        Table<ConstPtr<ImDrawList>, Retained> mRetained;
+        Vector<Layout>               mLayouts;
+        Recording                    mRecording;
+        UInt32                       mFrame              = 0;
+        Vector<Job>                  mJobs;
+        Vector<ImGuiKernel::Bounds>  mBounds;
+        UInt32                       mParallelThreshold  = 65536;
+        Vector<ImTextureRect>        mRectangles;
+        Table<SInt32, Residency>     mTextures;
+        Table<UInt64, Vector<Pooled>> mPool;
+        UInt32                       mPoolBytes          = 0;
+        Table<UInt64, Material>      mMaterials;
     };
 }
\ No newline at end of file
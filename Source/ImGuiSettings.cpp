@@ -0,0 +1,190 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "ImGuiSettings.hpp"
+#include <cstdio>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ImGuiSettings::~ImGuiSettings()
+    {
+        ZY_ASSERT(!mWorker.joinable(), "The settings must be closed before they are destroyed");
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSettings::Open(Text Path)
+    {
+        // The settings are read and written here only, so ImGui must never touch the file on the frame thread.
+        ImGui::GetIO().IniFilename = nullptr;
+
+        if (Path.empty())
+        {
+            return;
+        }
+
+        mPath    = Path;
+        mRunning = true;
+        mLoaded  = false;
+        mApplied = false;
+        mWorker  = std::thread(&ImGuiSettings::Run, this);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSettings::Close()
+    {
+        if (!mWorker.joinable())
+        {
+            return;
+        }
+
+        // Settings changed since the last write are saved right away, instead of waiting for them to settle.
+        if (mApplied && (mDirty || ImGui::GetIO().WantSaveIniSettings))
+        {
+            Save();
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock(mMutex);
+            mRunning = false;
+        }
+        mSignal.notify_one();
+        mWorker.join();
+
+        mApplied = true;
+        mContents.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSettings::Update(Real64 Time)
+    {
+        // Only waits when the first frame starts before the file has been read.
+        if (!mApplied)
+        {
+            std::unique_lock<std::mutex> Lock(mMutex);
+            mSignal.wait(Lock, [this] { return mLoaded; });
+
+            if (!mContents.empty())
+            {
+                ImGui::LoadIniSettingsFromMemory(mContents.data(), mContents.size());
+            }
+            mContents = Str();
+            mApplied  = true;
+        }
+
+        // ImGui already throttles its requests, but keeps requesting while the layout is being dragged, so every
+        // request restarts the wait and only the layout the user settles on is written.
+        Ref<ImGuiIO> IO = ImGui::GetIO();
+
+        if (IO.WantSaveIniSettings)
+        {
+            IO.WantSaveIniSettings = false;
+
+            mDirty     = mWorker.joinable();
+            mQuietTime = 0.0;
+        }
+        else if (mDirty && (mQuietTime += Time) >= kDebounce)
+        {
+            Save();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSettings::Save()
+    {
+        size_t     Size = 0;
+        const Text Data(ImGui::SaveIniSettingsToMemory(AddressOf(Size)), Size);
+
+        ImGui::GetIO().WantSaveIniSettings = false;
+        mDirty = false;
+
+        {
+            std::lock_guard<std::mutex> Lock(mMutex);
+            mSnapshot.assign(Data);
+            mPending = true;
+        }
+        mSignal.notify_one();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSettings::Run()
+    {
+        Str Contents;
+
+        if (const Ptr<std::FILE> File = std::fopen(mPath.c_str(), "rb"))
+        {
+            std::fseek(File, 0, SEEK_END);
+            Contents.resize(static_cast<UInt32>(Max(std::ftell(File), 0L)));
+            std::fseek(File, 0, SEEK_SET);
+
+            if (std::fread(Contents.data(), 1, Contents.size(), File) != Contents.size())
+            {
+                Contents.clear();
+            }
+            std::fclose(File);
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock(mMutex);
+            mContents = Move(Contents);
+            mLoaded   = true;
+        }
+        mSignal.notify_one();
+
+        const Str Temporary = mPath + ".tmp";
+
+        for (std::unique_lock<std::mutex> Lock(mMutex); ; )
+        {
+            mSignal.wait(Lock, [this] { return mPending || !mRunning; });
+
+            if (!mPending)
+            {
+                break;
+            }
+
+            // Writing happens outside the lock, so the frame thread can hand over a newer snapshot meanwhile.
+            const Str Snapshot = Move(mSnapshot);
+            mPending = false;
+            Lock.unlock();
+
+            // Write a sibling file first and swap it in, so an interrupted write never leaves a truncated file.
+            if (const Ptr<std::FILE> File = std::fopen(Temporary.c_str(), "wb"))
+            {
+                const Bool Complete = std::fwrite(Snapshot.data(), 1, Snapshot.size(), File) == Snapshot.size();
+
+                if (std::fclose(File) == 0 && Complete && std::rename(Temporary.c_str(), mPath.c_str()) != 0)
+                {
+                    std::remove(mPath.c_str());
+                    std::rename(Temporary.c_str(), mPath.c_str());
+                }
+            }
+            Lock.lock();
+        }
+    }
+}
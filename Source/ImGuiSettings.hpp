@@ -0,0 +1,92 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <imgui.h>
+#include <Zyphryon.Base/Base.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// \brief Persists the layout and settings of an ImGui context without blocking the frame thread.
+    ///
+    /// Replaces ImGui's own `.ini` handling, which reads and writes the file synchronously on the frame thread. The
+    /// file is read by a background thread as soon as the settings are opened, and saves are serialized in memory,
+    /// held back until the UI stops changing, then written by the same thread. Only the latest snapshot is written, so
+    /// a slow disk never accumulates stale saves.
+    class ImGuiSettings final
+    {
+    public:
+
+        /// Number of seconds the settings must stay unchanged before they are written.
+        static constexpr Real64 kDebounce = 1.0;
+
+    public:
+
+        /// Ensures pending settings are written and the background thread is stopped.
+        ~ImGuiSettings();
+
+        /// Starts reading the settings file in the background, and disables ImGui's own file handling.
+        ///
+        /// Must be called with the context current.
+        ///
+        /// \param Path The path of the settings file, or empty to disable persistence.
+        void Open(Text Path);
+
+        /// Writes pending settings and stops the background thread.
+        ///
+        /// Must be called with the context current, before the context is destroyed.
+        void Close();
+
+        /// Applies the settings read so far and schedules the saves requested by ImGui.
+        ///
+        /// Must be called with the context current, before every new frame. The first call waits for the settings file
+        /// to be read, since windows created by the first frame look up their settings.
+        ///
+        /// \param Time The time elapsed since the previous call, in seconds.
+        void Update(Real64 Time);
+
+    private:
+
+        /// Serializes the settings of the current context and hands them to the background thread.
+        void Save();
+
+        /// Reads the settings file, then writes every snapshot handed over until the settings are closed.
+        void Run();
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Str                     mPath;
+        std::thread             mWorker;
+        std::mutex              mMutex;
+        std::condition_variable mSignal;
+        Bool                    mRunning   = false;
+        Bool                    mLoaded    = false;
+        Bool                    mApplied   = true;
+        Str                     mContents;
+        Str                     mSnapshot;
+        Bool                    mPending   = false;
+        Bool                    mDirty     = false;
+        Real64                  mQuietTime = 0.0;
+    };
+}
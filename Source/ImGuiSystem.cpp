@@ -11,6 +11,11 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "ImGuiSystem.hpp"
+#include "ImGuiFontCache.hpp"
+#include <imgui_internal.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
 #include <Zyphryon.Input/Service.hpp>
 #include <Zyphryon.Platform/Service.hpp>
 
@@ -23,220 +28,149 @@ namespace Plugin
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    static ImGuiKey GetKey(Input::Key Key)
+    static constexpr std::pair<Input::Key, ImGuiKey> kKeyMapping[] = {
+        { Input::Key::Space,        ImGuiKey_Space },
+        { Input::Key::Apostrophe,   ImGuiKey_Apostrophe },
+        { Input::Key::Comma,        ImGuiKey_Comma },
+        { Input::Key::Minus,        ImGuiKey_Minus },
+        { Input::Key::Period,       ImGuiKey_Period },
+        { Input::Key::Slash,        ImGuiKey_Slash },
+        { Input::Key::Alpha0,       ImGuiKey_0 },
+        { Input::Key::Alpha1,       ImGuiKey_1 },
+        { Input::Key::Alpha2,       ImGuiKey_2 },
+        { Input::Key::Alpha3,       ImGuiKey_3 },
+        { Input::Key::Alpha4,       ImGuiKey_4 },
+        { Input::Key::Alpha5,       ImGuiKey_5 },
+        { Input::Key::Alpha6,       ImGuiKey_6 },
+        { Input::Key::Alpha7,       ImGuiKey_7 },
+        { Input::Key::Alpha8,       ImGuiKey_8 },
+        { Input::Key::Alpha9,       ImGuiKey_9 },
+        { Input::Key::Semicolon,    ImGuiKey_Semicolon },
+        { Input::Key::Equal,        ImGuiKey_Equal },
+        { Input::Key::A,            ImGuiKey_A },
+        { Input::Key::B,            ImGuiKey_B },
+        { Input::Key::C,            ImGuiKey_C },
+        { Input::Key::D,            ImGuiKey_D },
+        { Input::Key::E,            ImGuiKey_E },
+        { Input::Key::F,            ImGuiKey_F },
+        { Input::Key::G,            ImGuiKey_G },
+        { Input::Key::H,            ImGuiKey_H },
+        { Input::Key::I,            ImGuiKey_I },
+        { Input::Key::J,            ImGuiKey_J },
+        { Input::Key::K,            ImGuiKey_K },
+        { Input::Key::L,            ImGuiKey_L },
+        { Input::Key::M,            ImGuiKey_M },
+        { Input::Key::N,            ImGuiKey_N },
+        { Input::Key::O,            ImGuiKey_O },
+        { Input::Key::P,            ImGuiKey_P },
+        { Input::Key::Q,            ImGuiKey_Q },
+        { Input::Key::R,            ImGuiKey_R },
+        { Input::Key::S,            ImGuiKey_S },
+        { Input::Key::T,            ImGuiKey_T },
+        { Input::Key::U,            ImGuiKey_U },
+        { Input::Key::V,            ImGuiKey_V },
+        { Input::Key::W,            ImGuiKey_W },
+        { Input::Key::X,            ImGuiKey_X },
+        { Input::Key::Y,            ImGuiKey_Y },
+        { Input::Key::Z,            ImGuiKey_Z },
+        { Input::Key::Backslash,    ImGuiKey_Backslash },
+        { Input::Key::Grave,        ImGuiKey_GraveAccent },
+        { Input::Key::Escape,       ImGuiKey_Escape },
+        { Input::Key::Enter,        ImGuiKey_Enter },
+        { Input::Key::Tab,          ImGuiKey_Tab },
+        { Input::Key::Backspace,    ImGuiKey_Backspace },
+        { Input::Key::Insert,       ImGuiKey_Insert },
+        { Input::Key::Delete,       ImGuiKey_Delete },
+        { Input::Key::Right,        ImGuiKey_RightArrow },
+        { Input::Key::Left,         ImGuiKey_LeftArrow },
+        { Input::Key::Down,         ImGuiKey_DownArrow },
+        { Input::Key::Up,           ImGuiKey_UpArrow },
+        { Input::Key::PageUp,       ImGuiKey_PageUp },
+        { Input::Key::PageDown,     ImGuiKey_PageDown },
+        { Input::Key::Home,         ImGuiKey_Home },
+        { Input::Key::End,          ImGuiKey_End },
+        { Input::Key::Capital,      ImGuiKey_CapsLock },
+        { Input::Key::Scroll,       ImGuiKey_ScrollLock },
+        { Input::Key::NumLock,      ImGuiKey_NumLock },
+        { Input::Key::Print,        ImGuiKey_PrintScreen },
+        { Input::Key::Pause,        ImGuiKey_Pause },
+        { Input::Key::F1,           ImGuiKey_F1 },
+        { Input::Key::F2,           ImGuiKey_F2 },
+        { Input::Key::F3,           ImGuiKey_F3 },
+        { Input::Key::F4,           ImGuiKey_F4 },
+        { Input::Key::F5,           ImGuiKey_F5 },
+        { Input::Key::F6,           ImGuiKey_F6 },
+        { Input::Key::F7,           ImGuiKey_F7 },
+        { Input::Key::F8,           ImGuiKey_F8 },
+        { Input::Key::F9,           ImGuiKey_F9 },
+        { Input::Key::F10,          ImGuiKey_F10 },
+        { Input::Key::F11,          ImGuiKey_F11 },
+        { Input::Key::F12,          ImGuiKey_F12 },
+        { Input::Key::Keypad0,      ImGuiKey_Keypad0 },
+        { Input::Key::Keypad1,      ImGuiKey_Keypad1 },
+        { Input::Key::Keypad2,      ImGuiKey_Keypad2 },
+        { Input::Key::Keypad3,      ImGuiKey_Keypad3 },
+        { Input::Key::Keypad4,      ImGuiKey_Keypad4 },
+        { Input::Key::Keypad5,      ImGuiKey_Keypad5 },
+        { Input::Key::Keypad6,      ImGuiKey_Keypad6 },
+        { Input::Key::Keypad7,      ImGuiKey_Keypad7 },
+        { Input::Key::Keypad8,      ImGuiKey_Keypad8 },
+        { Input::Key::Keypad9,      ImGuiKey_Keypad9 },
+        { Input::Key::Decimal,      ImGuiKey_KeypadDecimal },
+        { Input::Key::Divide,       ImGuiKey_KeypadDivide },
+        { Input::Key::Multiply,     ImGuiKey_KeypadMultiply },
+        { Input::Key::Subtract,     ImGuiKey_KeypadSubtract },
+        { Input::Key::Add,          ImGuiKey_KeypadAdd },
+        { Input::Key::LeftBracket,  ImGuiKey_LeftBracket },
+        { Input::Key::LeftShift,    ImGuiKey_LeftShift },
+        { Input::Key::LeftCtrl,     ImGuiKey_LeftCtrl },
+        { Input::Key::LeftAlt,      ImGuiKey_LeftAlt },
+        { Input::Key::LeftSuper,    ImGuiKey_LeftSuper },
+        { Input::Key::Menu,         ImGuiKey_Menu },
+        { Input::Key::RightBracket, ImGuiKey_RightBracket },
+        { Input::Key::RightShift,   ImGuiKey_RightShift },
+        { Input::Key::RightCtrl,    ImGuiKey_RightCtrl },
+        { Input::Key::RightAlt,     ImGuiKey_RightAlt },
+        { Input::Key::RightSuper,   ImGuiKey_RightSuper },
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static constexpr UInt32 kKeyCount = []
     {
-        switch (Key)
+        UInt32 Count = 0;
+
+        for (const auto [Key, ImKey] : kKeyMapping)
         {
-        case Input::Key::Space:
-            return ImGuiKey_Space;
-        case Input::Key::Apostrophe:
-            return ImGuiKey_Apostrophe;
-        case Input::Key::Comma:
-            return ImGuiKey_Comma;
-        case Input::Key::Minus:
-            return ImGuiKey_Minus;
-        case Input::Key::Period:
-            return ImGuiKey_Period;
-        case Input::Key::Slash:
-            return ImGuiKey_Slash;
-        case Input::Key::Alpha0:
-            return ImGuiKey_0;
-        case Input::Key::Alpha1:
-            return ImGuiKey_1;
-        case Input::Key::Alpha2:
-            return ImGuiKey_2;
-        case Input::Key::Alpha3:
-            return ImGuiKey_3;
-        case Input::Key::Alpha4:
-            return ImGuiKey_4;
-        case Input::Key::Alpha5:
-            return ImGuiKey_5;
-        case Input::Key::Alpha6:
-            return ImGuiKey_6;
-        case Input::Key::Alpha7:
-            return ImGuiKey_7;
-        case Input::Key::Alpha8:
-            return ImGuiKey_8;
-        case Input::Key::Alpha9:
-            return ImGuiKey_9;
-        case Input::Key::Semicolon:
-            return ImGuiKey_Semicolon;
-        case Input::Key::Equal:
-            return ImGuiKey_Equal;
-        case Input::Key::A:
-            return ImGuiKey_A;
-        case Input::Key::B:
-            return ImGuiKey_B;
-        case Input::Key::C:
-            return ImGuiKey_C;
-        case Input::Key::D:
-            return ImGuiKey_D;
-        case Input::Key::E:
-            return ImGuiKey_E;
-        case Input::Key::F:
-            return ImGuiKey_F;
-        case Input::Key::G:
-            return ImGuiKey_G;
-        case Input::Key::H:
-            return ImGuiKey_H;
-        case Input::Key::I:
-            return ImGuiKey_I;
-        case Input::Key::J:
-            return ImGuiKey_J;
-        case Input::Key::K:
-            return ImGuiKey_K;
-        case Input::Key::L:
-            return ImGuiKey_L;
-        case Input::Key::M:
-            return ImGuiKey_M;
-        case Input::Key::N:
-            return ImGuiKey_N;
-        case Input::Key::O:
-            return ImGuiKey_O;
-        case Input::Key::P:
-            return ImGuiKey_P;
-        case Input::Key::Q:
-            return ImGuiKey_Q;
-        case Input::Key::R:
-            return ImGuiKey_R;
-        case Input::Key::S:
-            return ImGuiKey_S;
-        case Input::Key::T:
-            return ImGuiKey_T;
-        case Input::Key::U:
-            return ImGuiKey_U;
-        case Input::Key::V:
-            return ImGuiKey_V;
-        case Input::Key::W:
-            return ImGuiKey_W;
-        case Input::Key::X:
-            return ImGuiKey_X;
-        case Input::Key::Y:
-            return ImGuiKey_Y;
-        case Input::Key::Z:
-            return ImGuiKey_Z;
-        case Input::Key::Backslash:
-            return ImGuiKey_Backslash;
-        case Input::Key::Grave:
-            return ImGuiKey_GraveAccent;
-        case Input::Key::Escape:
-            return ImGuiKey_Escape;
-        case Input::Key::Enter:
-            return ImGuiKey_Enter;
-        case Input::Key::Tab:
-            return ImGuiKey_Tab;
-        case Input::Key::Backspace:
-            return ImGuiKey_Backspace;
-        case Input::Key::Insert:
-            return ImGuiKey_Insert;
-        case Input::Key::Delete:
-            return ImGuiKey_Delete;
-        case Input::Key::Right:
-            return ImGuiKey_RightArrow;
-        case Input::Key::Left:
-            return ImGuiKey_LeftArrow;
-        case Input::Key::Down:
-            return ImGuiKey_DownArrow;
-        case Input::Key::Up:
-            return ImGuiKey_UpArrow;
-        case Input::Key::PageUp:
-            return ImGuiKey_PageUp;
-        case Input::Key::PageDown:
-            return ImGuiKey_PageDown;
-        case Input::Key::Home:
-            return ImGuiKey_Home;
-        case Input::Key::End:
-            return ImGuiKey_End;
-        case Input::Key::Capital:
-            return ImGuiKey_CapsLock;
-        case Input::Key::Scroll:
-            return ImGuiKey_ScrollLock;
-        case Input::Key::NumLock:
-            return ImGuiKey_NumLock;
-        case Input::Key::Print:
-            return ImGuiKey_PrintScreen;
-        case Input::Key::Pause:
-            return ImGuiKey_Pause;
-        case Input::Key::F1:
-            return ImGuiKey_F1;
-        case Input::Key::F2:
-            return ImGuiKey_F2;
-        case Input::Key::F3:
-            return ImGuiKey_F3;
-        case Input::Key::F4:
-            return ImGuiKey_F4;
-        case Input::Key::F5:
-            return ImGuiKey_F5;
-        case Input::Key::F6:
-            return ImGuiKey_F6;
-        case Input::Key::F7:
-            return ImGuiKey_F7;
-        case Input::Key::F8:
-            return ImGuiKey_F8;
-        case Input::Key::F9:
-            return ImGuiKey_F9;
-        case Input::Key::F10:
-            return ImGuiKey_F10;
-        case Input::Key::F11:
-            return ImGuiKey_F11;
-        case Input::Key::F12:
-            return ImGuiKey_F12;
-        case Input::Key::Keypad0:
-            return ImGuiKey_Keypad0;
-        case Input::Key::Keypad1:
-            return ImGuiKey_Keypad1;
-        case Input::Key::Keypad2:
-            return ImGuiKey_Keypad2;
-        case Input::Key::Keypad3:
-            return ImGuiKey_Keypad3;
-        case Input::Key::Keypad4:
-            return ImGuiKey_Keypad4;
-        case Input::Key::Keypad5:
-            return ImGuiKey_Keypad5;
-        case Input::Key::Keypad6:
-            return ImGuiKey_Keypad6;
-        case Input::Key::Keypad7:
-            return ImGuiKey_Keypad7;
-        case Input::Key::Keypad8:
-            return ImGuiKey_Keypad8;
-        case Input::Key::Keypad9:
-            return ImGuiKey_Keypad9;
-        case Input::Key::Decimal:
-            return ImGuiKey_KeypadDecimal;
-        case Input::Key::Divide:
-            return ImGuiKey_KeypadDivide;
-        case Input::Key::Multiply:
-            return ImGuiKey_KeypadMultiply;
-        case Input::Key::Subtract:
-            return ImGuiKey_KeypadSubtract;
-        case Input::Key::Add:
-            return ImGuiKey_KeypadAdd;
-        case Input::Key::LeftBracket:
-            return ImGuiKey_LeftBracket;
-        case Input::Key::LeftShift:
-            return ImGuiKey_LeftShift;
-        case Input::Key::LeftCtrl:
-            return ImGuiKey_LeftCtrl;
-        case Input::Key::LeftAlt:
-            return ImGuiKey_LeftAlt;
-        case Input::Key::LeftSuper:
-            return ImGuiKey_LeftSuper;
-        case Input::Key::Menu:
-            return ImGuiKey_Menu;
-        case Input::Key::RightBracket:
-            return ImGuiKey_RightBracket;
-        case Input::Key::RightShift:
-            return ImGuiKey_RightShift;
-        case Input::Key::RightCtrl:
-            return ImGuiKey_RightCtrl;
-        case Input::Key::RightAlt:
-            return ImGuiKey_RightAlt;
-        case Input::Key::RightSuper:
-            return ImGuiKey_RightSuper;
-        case Input::Key::Unknown:
-            break;
+            Count = Max(Count, static_cast<UInt32>(Key) + 1);
+        }
+        return Count;
+    }();
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static constexpr Array<ImGuiKey, kKeyCount> kKeyTable = []
+    {
+        // Indexed by engine key, every key without an entry in the mapping translates to ImGuiKey_None.
+        Array<ImGuiKey, kKeyCount> Table { };
+        Table.fill(ImGuiKey_None);
+
+        for (const auto [Key, ImKey] : kKeyMapping)
+        {
+            Table[static_cast<UInt32>(Key)] = ImKey;
         }
-        return ImGuiKey_None;
+        return Table;
+    }();
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static ImGuiKey GetKey(Input::Key Key)
+    {
+        const UInt32 Index = static_cast<UInt32>(Key);
+        return Index < kKeyCount ? kKeyTable[Index] : ImGuiKey_None;
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -285,11 +219,19 @@ namespace Plugin
         }
     }
 
+    static Real64 GetElapsed(std::chrono::steady_clock::time_point Start)
+    {
+        return std::chrono::duration<Real64, std::milli>(std::chrono::steady_clock::now() - Start).count();
+    }
+
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
     void ImGuiSystem::Initialize(Ref<Engine::Subsystem::Host> Host)
     {
+        mStartup     = std::chrono::steady_clock::now();
+        mStartupTime = 0.0;
+
         ConstRetainer<Platform::Service> Platform = Host.GetService<Platform::Service>();
 
         // Fetches the window and the monitor the window is at.
@@ -300,35 +242,52 @@ namespace Plugin
         const Real32 Width  = static_cast<Real32>(Window.GetWidth());
         const Real32 Height = static_cast<Real32>(Window.GetHeight());
 
+        // Route ImGui's allocations through the pooled allocator, before any context allocates memory.
+        ImGuiAllocator::Install();
+
         // Create the ImGui context and configure basic IO flags (keyboard navigation, docking, renderer features).
-        ImGui::CreateContext();
+        mContext = ImGui::CreateContext();
+        ImGui::SetCurrentContext(mContext);
 
         Ref<ImGuiIO> IO = ImGui::GetIO();
         IO.ConfigFlags            |= ImGuiConfigFlags_NavEnableKeyboard | ImGuiConfigFlags_DockingEnable;
         IO.DisplaySize             = ImVec2(Width, Height);
         IO.DisplayFramebufferScale = ImVec2(Monitor->GetScale(), Monitor->GetScale());
-        IO.BackendPlatformUserData = &* Platform;
+        IO.BackendPlatformUserData = this;
+
+        // Start reading the layout right away, so it is usually ready by the first frame.
+        mSettings.Open(mSettingsPath);
 
         // TODO: Clipboard functionality
 
         // Apply the default dark theme styling.
         ImGui::StyleColorsDark();
 
+        // A served UI is rendered and driven by the viewer, so it needs neither a renderer backend nor local input.
+        if (mRemote.GetRole() == ImGuiRemote::Role::Server)
+        {
+            IO.BackendRendererName = "Zyphryon Remote";
+            IO.BackendFlags = SetBit(IO.BackendFlags, ImGuiBackendFlags_RendererHasTextures);
+            IO.BackendFlags = SetBit(IO.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
+            ImGuiFontCache::Apply(IO.Fonts);
+            return;
+        }
+
         // Initialize the renderer backend for ImGui.
         mRenderer.Initialize(Host);
 
         // Register input event callbacks.
         ConstRetainer<Input::Service> Input = Host.GetService<Input::Service>();
 
-        Input->OnKeyDown.AddFunction<&ImGuiSystem::OnKeyDown>();
-        Input->OnKeyUp.AddFunction<&ImGuiSystem::OnKeyUp>();
-        Input->OnKeyType.AddFunction<&ImGuiSystem::OnKeyType>();
-        Input->OnMouseDown.AddFunction<&ImGuiSystem::OnMouseDown>();
-        Input->OnMouseUp.AddFunction<&ImGuiSystem::OnMouseUp>();
-        Input->OnMouseMove.AddFunction<&ImGuiSystem::OnMouseMove>();
-        Input->OnMouseScroll.AddFunction<&ImGuiSystem::OnMouseScroll>();
-        Input->OnWindowFocus.AddFunction<&ImGuiSystem::OnWindowFocus>();
-        Input->OnWindowResize.AddFunction<&ImGuiSystem::OnWindowResize>();
+        Input->OnKeyDown.AddFunction<&ImGuiSystem::OnKeyDown>(this);
+        Input->OnKeyUp.AddFunction<&ImGuiSystem::OnKeyUp>(this);
+        Input->OnKeyType.AddFunction<&ImGuiSystem::OnKeyType>(this);
+        Input->OnMouseDown.AddFunction<&ImGuiSystem::OnMouseDown>(this);
+        Input->OnMouseUp.AddFunction<&ImGuiSystem::OnMouseUp>(this);
+        Input->OnMouseMove.AddFunction<&ImGuiSystem::OnMouseMove>(this);
+        Input->OnMouseScroll.AddFunction<&ImGuiSystem::OnMouseScroll>(this);
+        Input->OnWindowFocus.AddFunction<&ImGuiSystem::OnWindowFocus>(this);
+        Input->OnWindowResize.AddFunction<&ImGuiSystem::OnWindowResize>(this);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -336,24 +295,36 @@ namespace Plugin
 
     void ImGuiSystem::Teardown(Ref<Engine::Subsystem::Host> Host)
     {
-        // Dispose of the renderer backend.
-        mRenderer.Dispose();
+        ImGui::SetCurrentContext(mContext);
 
-        // Releases all input event callbacks.
-        ConstRetainer<Input::Service> Input = Host.GetService<Input::Service>();
+        // Finish any capture in progress, and write the layout changes not persisted yet.
+        mCapture.Close();
+        mSettings.Close();
 
-        Input->OnKeyDown.RemoveFunction<&ImGuiSystem::OnKeyDown>();
-        Input->OnKeyUp.RemoveFunction<&ImGuiSystem::OnKeyUp>();
-        Input->OnKeyType.RemoveFunction<&ImGuiSystem::OnKeyType>();
-        Input->OnMouseDown.RemoveFunction<&ImGuiSystem::OnMouseDown>();
-        Input->OnMouseUp.RemoveFunction<&ImGuiSystem::OnMouseUp>();
-        Input->OnMouseMove.RemoveFunction<&ImGuiSystem::OnMouseMove>();
-        Input->OnMouseScroll.RemoveFunction<&ImGuiSystem::OnMouseScroll>();
-        Input->OnWindowFocus.RemoveFunction<&ImGuiSystem::OnWindowFocus>();
-        Input->OnWindowResize.RemoveFunction<&ImGuiSystem::OnWindowResize>();
+        if (mRemote.GetRole() != ImGuiRemote::Role::Server)
+        {
+            // Dispose of the renderer backend, along with the textures of a remote UI being viewed.
+            mViewer.Close(mRenderer);
+            mRenderer.Dispose();
+
+            // Releases all input event callbacks.
+            ConstRetainer<Input::Service> Input = Host.GetService<Input::Service>();
+
+            Input->OnKeyDown.RemoveFunction<&ImGuiSystem::OnKeyDown>(this);
+            Input->OnKeyUp.RemoveFunction<&ImGuiSystem::OnKeyUp>(this);
+            Input->OnKeyType.RemoveFunction<&ImGuiSystem::OnKeyType>(this);
+            Input->OnMouseDown.RemoveFunction<&ImGuiSystem::OnMouseDown>(this);
+            Input->OnMouseUp.RemoveFunction<&ImGuiSystem::OnMouseUp>(this);
+            Input->OnMouseMove.RemoveFunction<&ImGuiSystem::OnMouseMove>(this);
+            Input->OnMouseScroll.RemoveFunction<&ImGuiSystem::OnMouseScroll>(this);
+            Input->OnWindowFocus.RemoveFunction<&ImGuiSystem::OnWindowFocus>(this);
+            Input->OnWindowResize.RemoveFunction<&ImGuiSystem::OnWindowResize>(this);
+        }
+        mRemote.Close();
 
         // Destroy the context last, since disposing the renderer above still walks the platform texture list.
-        ImGui::DestroyContext();
+        ImGui::DestroyContext(mContext);
+        mContext = nullptr;
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -361,8 +332,92 @@ namespace Plugin
 
     void ImGuiSystem::Begin(Real64 Time)
     {
-        ImGui::GetIO().DeltaTime = static_cast<Real32>(Time);
+        ImGui::SetCurrentContext(mContext);
+
+        mStatistics = Statistics();
+
+        // A viewer builds no UI of its own, \ref End forwards its input and renders the frames it receives instead.
+        if (mRemote.GetRole() == ImGuiRemote::Role::Viewer)
+        {
+            mReplay = true;
+            return;
+        }
+
+        // A served UI receives the viewer's input, and rebuilds for a new viewer so it gets a frame right away.
+        if (mRemote.GetRole() == ImGuiRemote::Role::Server)
+        {
+            if (mRemote.Accept())
+            {
+                Invalidate();
+            }
+
+            mRemote.Poll([this](ImGuiRemote::Message Type, ConstSpan<Byte> Payload)
+            {
+                // Events come from the network, so anything ImGui would index with is checked first.
+                Event Value;
+
+                if (Type == ImGuiRemote::Message::Input && Decode(Payload, Value) && IsValid(Value))
+                {
+                    Enqueue(Value);
+                }
+            });
+        }
+
+        // Apply the layout read at startup, and persist the changes ImGui requested once they settle.
+        mSettings.Update(Time);
+
+        // Feed the input queued since the last frame, which also restarts the idle timer if anything changed.
+        Drain(ImGui::GetIO());
+
+        const Bool Dirty = mDirty.exchange(false, std::memory_order_acquire);
+
+        if (Dirty)
+        {
+            mIdleTime = 0.0;
+        }
+
+        mIdleTime    += Time;
+        mPendingTime += Time;
+
+        // Replay the previous frame while nothing changed and every animation or timer had time to settle, or while
+        // the refresh period has not elapsed yet; input marks the UI as dirty, which forces a rebuild either way.
+        const Bool Idle    = mLazy && mIdleTime > kLazyTimeout;
+        const Bool Waiting = mPendingTime < mRefreshPeriod;
+
+        mReplay = !Dirty && (Idle || Waiting);
+
+        if (mReplay)
+        {
+            ++mSkippedFrames;
+            return;
+        }
+
+        // Skipped frames still advance ImGui's clock, so timers observe the real elapsed time.
+        Ref<ImGuiIO> IO = ImGui::GetIO();
+        IO.DeltaTime                = static_cast<Real32>(mPendingTime);
+        IO.ConfigMemoryCompactTimer = mCompactTimer;
+
+        // Over budget, let the new frame release the buffers of every hidden window instead of waiting for the timer.
+        const ImGuiAllocator::Statistics Memory = ImGuiAllocator::GetStatistics();
+        mAllocations = Memory.Allocations;
+
+        const Bool Compact = mMemoryBudget > 0 && Memory.Live > mMemoryBudget;
+
+        if (Compact)
+        {
+            ImGui::GetCurrentContext()->GcCompactAll = true;
+        }
+
+        const auto Start = std::chrono::steady_clock::now();
         ImGui::NewFrame();
+        mStatistics.NewFrameTime = GetElapsed(Start);
+
+        if (Compact)
+        {
+            ImGuiAllocator::Trim();
+        }
+
+        mPendingTime = 0.0;
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -370,12 +425,396 @@ namespace Plugin
 
     void ImGuiSystem::End()
     {
-        ImGui::Render();
+        ImGui::SetCurrentContext(mContext);
+
+        // The draw data of the last rebuilt frame stays valid until the next frame begins, so it can be replayed.
+        if (!mReplay)
+        {
+            if (mOverlay)
+            {
+                DrawOverlay();
+            }
+
+            const auto Start = std::chrono::steady_clock::now();
+            ImGui::Render();
+            mStatistics.RenderTime = GetElapsed(Start);
+
+            // Keep rebuilding while the user interacts with the UI (e.g. a blinking caret or an active drag).
+            Ref<ImGuiIO> IO = ImGui::GetIO();
+
+            if (IO.WantTextInput || ImGui::IsAnyItemActive())
+            {
+                mIdleTime = 0.0;
+            }
+
+            // Publish the capture state for the handlers, which answer on the input thread.
+            mCaptureKeys.store(IO.WantCaptureKeyboard, std::memory_order_relaxed);
+            mCaptureMouse.store(IO.WantCaptureMouse, std::memory_order_relaxed);
+        }
+
+        const ConstPtr<ImDrawData> Commands = ImGui::GetDrawData();
+
+        if (mRemote.GetRole() == ImGuiRemote::Role::Viewer)
+        {
+            View();
+        }
+        else if (mRemote.GetRole() == ImGuiRemote::Role::Server)
+        {
+            // Replayed frames are left out, since the viewer still shows them.
+            if (Commands && !mReplay)
+            {
+                mCapture.Write(* Commands);
+
+                const auto Start = std::chrono::steady_clock::now();
+                mRemote.Publish(* Commands);
+                mStatistics.SubmitTime = GetElapsed(Start);
+            }
+        }
+        else if (Commands && Commands->TotalVtxCount > 0)
+        {
+            // Capture before submitting, since submitting consumes the pending texture operations.
+            mCapture.Write(* Commands);
+
+            // A replayed frame re-issues the commands recorded for it, instead of translating its draw data again.
+            const auto Start = std::chrono::steady_clock::now();
+
+            if (mReplay)
+            {
+                mRenderer.Resubmit(* Commands);
+            }
+            else
+            {
+                mRenderer.Submit(* Commands);
+            }
+            mStatistics.SubmitTime = GetElapsed(Start);
+            mStatistics.Renderer   = mRenderer.GetStatistics();
+        }
+
+        // Frames submitted before the techniques finished compiling draw nothing, so they do not count as the first.
+        if (mStartupTime == 0.0 && Commands && IsReady())
+        {
+            mStartupTime = GetElapsed(mStartup);
+        }
+
+        // Account for the memory of the frame, replayed frames allocate nothing.
+        mStatistics.Memory = ImGuiAllocator::GetStatistics();
+
+        if (!mReplay)
+        {
+            mStatistics.Allocations = static_cast<UInt32>(mStatistics.Memory.Allocations - mAllocations);
+        }
+
+        // Record the frame, so the statistics window graphs every frame including replayed ones.
+        const Real64 Time  = mStatistics.NewFrameTime + mStatistics.RenderTime + mStatistics.SubmitTime;
+        const UInt32 Bytes = mStatistics.Renderer.Uploaded + mStatistics.Renderer.TextureBytes;
+        mHistoryTime[mHistoryOffset]  = static_cast<Real32>(Time);
+        mHistoryCount[mHistoryOffset] = static_cast<Real32>(mStatistics.Renderer.Commands);
+        mHistoryBytes[mHistoryOffset] = static_cast<Real32>(Bytes);
+        mHistoryOffset = (mHistoryOffset + 1) % kHistorySize;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Ptr<ImFont> ImGuiSystem::AddDistanceFont(ConstSpan<Byte> Data, Real32 Size)
+    {
+        return mRenderer.AddDistanceFont(Data, Size);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSystem::SetFontCache(Text Directory)
+    {
+        // Before initialization there is no atlas yet, and the cache is applied to it once it is created.
+        if (mContext)
+        {
+            ImGui::SetCurrentContext(mContext);
+            mRenderer.SetFontCache(Directory);
+        }
+        else
+        {
+            ImGuiFontCache::SetDirectory(Directory);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiSystem::Serve(UInt16 Port, Text Address)
+    {
+        ZY_ASSERT(mContext == nullptr, "The system must be served before it is initialized");
+
+        return mRemote.Listen(Port, Address);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiSystem::Connect(Text Address, UInt16 Port)
+    {
+        ZY_ASSERT(mContext != nullptr, "The system must be initialized before it connects");
 
-        if (const ConstPtr<ImDrawData> Commands = ImGui::GetDrawData(); Commands && Commands->TotalVtxCount > 0)
+        if (!mRemote.Connect(Address, Port))
         {
-            mRenderer.Submit(* Commands);
+            return false;
         }
+
+        // The server only learns about the viewer's window through input, so report its current size right away.
+        ImGui::SetCurrentContext(mContext);
+
+        const ImVec2 Size = ImGui::GetIO().DisplaySize;
+        const Event  Value { .Type = Event::Kind::Resize, .Down = false, .Code = 0, .X = Size.x, .Y = Size.y };
+
+        Array<Byte, kEventSize> Payload;
+        Encode(Value, Payload);
+        mRemote.Send(ImGuiRemote::Message::Input, Payload);
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSystem::SetLazy(Bool Lazy)
+    {
+        mLazy = Lazy;
+        Invalidate();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSystem::SetRefreshRate(Real64 Rate)
+    {
+        mRefreshPeriod = (Rate > 0.0 ? 1.0 / Rate : 0.0);
+        Invalidate();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSystem::Invalidate()
+    {
+        mDirty.store(true, std::memory_order_release);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSystem::Encode(ConstRef<Event> Value, Ref<Array<Byte, kEventSize>> Output)
+    {
+        Output[0] = Enum::Cast(Value.Type);
+        Output[1] = Value.Down ? 1 : 0;
+        std::memcpy(Output.data() + 2,  AddressOf(Value.Code), sizeof(Value.Code));
+        std::memcpy(Output.data() + 6,  AddressOf(Value.X),    sizeof(Value.X));
+        std::memcpy(Output.data() + 10, AddressOf(Value.Y),    sizeof(Value.Y));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiSystem::Decode(ConstSpan<Byte> Payload, Ref<Event> Value)
+    {
+        // The flag is converted from its raw byte, since any value but 0 or 1 would not be a valid Bool.
+        if (Payload.size() != kEventSize || Payload[1] > 1)
+        {
+            return false;
+        }
+
+        Value.Type = static_cast<Event::Kind>(Payload[0]);
+        Value.Down = (Payload[1] == 1);
+        std::memcpy(AddressOf(Value.Code), Payload.data() + 2,  sizeof(Value.Code));
+        std::memcpy(AddressOf(Value.X),    Payload.data() + 6,  sizeof(Value.X));
+        std::memcpy(AddressOf(Value.Y),    Payload.data() + 10, sizeof(Value.Y));
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ImGuiSystem::IsValid(ConstRef<Event> Value)
+    {
+        switch (Value.Type)
+        {
+        case Event::Kind::Key:
+            return ImGui::IsNamedKeyOrMod(static_cast<ImGuiKey>(Value.Code));
+        case Event::Kind::Character:
+            return Value.Code <= IM_UNICODE_CODEPOINT_MAX;
+        case Event::Kind::MouseButton:
+            return Value.Code < ImGuiMouseButton_COUNT;
+        case Event::Kind::MouseMove:
+        case Event::Kind::MouseScroll:
+            return !std::isnan(Value.X) && !std::isnan(Value.Y);
+        case Event::Kind::Resize:
+            return std::isfinite(Value.X) && std::isfinite(Value.Y) && Value.X >= 0.0f && Value.Y >= 0.0f;
+        case Event::Kind::Focus:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSystem::Drain(Ref<ImGuiIO> IO)
+    {
+        Event Pending { };
+        Bool  Holding = false;
+
+        const auto Flush = [&]()
+        {
+            if (Holding)
+            {
+                if (Pending.Type == Event::Kind::MouseMove)
+                {
+                    IO.AddMousePosEvent(Pending.X, Pending.Y);
+                }
+                else
+                {
+                    IO.AddMouseWheelEvent(Pending.X, Pending.Y);
+                }
+                Holding = false;
+            }
+        };
+
+        mEvents.Drain([&](ConstRef<Event> Value)
+        {
+            // Hold motion back until an event of another kind arrives, so bursts collapse into a single event.
+            if (Value.Type == Event::Kind::MouseMove || Value.Type == Event::Kind::MouseScroll)
+            {
+                if (Holding && Pending.Type == Value.Type)
+                {
+                    if (Value.Type == Event::Kind::MouseMove)
+                    {
+                        Pending.X = Value.X;
+                        Pending.Y = Value.Y;
+                    }
+                    else
+                    {
+                        Pending.X += Value.X;
+                        Pending.Y += Value.Y;
+                    }
+                    return;
+                }
+
+                Flush();
+
+                Pending = Value;
+                Holding = true;
+                return;
+            }
+
+            Flush();
+
+            switch (Value.Type)
+            {
+            case Event::Kind::Key:
+                IO.AddKeyEvent(static_cast<ImGuiKey>(Value.Code), Value.Down);
+                break;
+            case Event::Kind::Character:
+                IO.AddInputCharacter(Value.Code);
+                break;
+            case Event::Kind::MouseButton:
+                IO.AddMouseButtonEvent(static_cast<ImGuiMouseButton>(Value.Code), Value.Down);
+                break;
+            case Event::Kind::Focus:
+                IO.AddFocusEvent(Value.Down);
+                break;
+            case Event::Kind::Resize:
+                IO.DisplaySize = ImVec2(Value.X, Value.Y);
+                break;
+            default:
+                break;
+            }
+        });
+
+        Flush();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSystem::View()
+    {
+        // Forward the input queued since the last frame as it is, the server merges motion when it drains it.
+        mEvents.Drain([this](ConstRef<Event> Value)
+        {
+            Array<Byte, kEventSize> Payload;
+            Encode(Value, Payload);
+            mRemote.Send(ImGuiRemote::Message::Input, Payload);
+        });
+
+        const auto Start = std::chrono::steady_clock::now();
+
+        // Frames received together only need their texture operations applied, the last one is presented.
+        mRemote.Poll([this](ImGuiRemote::Message Type, ConstSpan<Byte> Payload)
+        {
+            if (Type == ImGuiRemote::Message::Frame)
+            {
+                mViewer.Decode(Payload);
+            }
+        });
+
+        if (mViewer.HasFrame())
+        {
+            mViewer.Present(mRenderer);
+            mStatistics.Renderer = mRenderer.GetStatistics();
+        }
+        mStatistics.SubmitTime = GetElapsed(Start);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSystem::DrawOverlay()
+    {
+        // The current frame is still being built, so the window shows the last recorded frame.
+        ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_FirstUseEver);
+        ImGui::SetNextWindowSize(ImVec2(340.0f, 0.0f), ImGuiCond_FirstUseEver);
+
+        if (ImGui::Begin("ImGui Statistics", AddressOf(mOverlay)))
+        {
+            const ConstRef<ImGuiRenderer::Statistics> Renderer = mRenderer.GetStatistics();
+
+            ImGui::Text("Lists %u, Vertices %u, Indices %u", Renderer.Lists, Renderer.Vertices, Renderer.Indices);
+            ImGui::Text("Commands %u, Merged %u (%u batched), Culled %u",
+                Renderer.Commands, Renderer.Merged, Renderer.Batched, Renderer.Culled);
+            ImGui::Text("Textures +%u ~%u -%u, %u recycled, %u uploads", Renderer.TextureCreates,
+                Renderer.TextureUpdates, Renderer.TextureDeletes, Renderer.TextureRecycles, Renderer.TextureUploads);
+            const ImGuiAllocator::Statistics Memory = ImGuiAllocator::GetStatistics();
+
+            ImGui::Text("Memory %.1f KiB, peak %.1f KiB, reserved %.1f KiB",
+                Memory.Live / 1024.0, Memory.Peak / 1024.0, Memory.Reserved / 1024.0);
+            ImGui::Text("Skipped frames %llu", static_cast<unsigned long long>(mSkippedFrames));
+            ImGui::Separator();
+
+            const UInt32 Last = (mHistoryOffset + kHistorySize - 1) % kHistorySize;
+
+            const auto Plot = [&](ConstPtr<Char> Label, ConstRef<decltype(mHistoryTime)> History, ConstPtr<Char> Format)
+            {
+                Char Overlay[32];
+                std::snprintf(Overlay, sizeof(Overlay), Format, History[Last]);
+
+                ImGui::PlotLines(
+                    Label, History.data(), kHistorySize, mHistoryOffset, Overlay, 0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+            };
+
+            Plot("CPU",      mHistoryTime,  "%.3f ms");
+            Plot("Commands", mHistoryCount, "%.0f");
+            Plot("Uploads",  mHistoryBytes, "%.0f bytes");
+        }
+        ImGui::End();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiSystem::Enqueue(ConstRef<Event> Value)
+    {
+        // A full queue means the frames stalled for thousands of events, dropping the newest ones is acceptable.
+        mEvents.Push(Value);
+        Invalidate();
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -383,11 +822,11 @@ namespace Plugin
 
     Bool ImGuiSystem::OnKeyType(Text Text)
     {
-        StrIterateUTF8(Text, [](UInt32 Codepoint)
+        StrIterateUTF8(Text, [this](UInt32 Codepoint)
         {
-            ImGui::GetIO().AddInputCharacter(Codepoint);
+            Enqueue({ .Type = Event::Kind::Character, .Code = Codepoint });
         });
-        return ImGui::GetIO().WantCaptureKeyboard;
+        return mCaptureKeys.load(std::memory_order_relaxed);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -397,13 +836,13 @@ namespace Plugin
     {
         if (const auto ImModifier = GetKeyModifier(Key); ImModifier != ImGuiMod_None)
         {
-            ImGui::GetIO().AddKeyEvent(ImModifier, false);
+            Enqueue({ .Type = Event::Kind::Key, .Down = false, .Code = static_cast<UInt32>(ImModifier) });
         }
         if (const auto ImKey = GetKey(Key); ImKey != ImGuiKey_None)
         {
-            ImGui::GetIO().AddKeyEvent(ImKey, false);
+            Enqueue({ .Type = Event::Kind::Key, .Down = false, .Code = static_cast<UInt32>(ImKey) });
         }
-        return ImGui::GetIO().WantCaptureKeyboard;
+        return mCaptureKeys.load(std::memory_order_relaxed);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -413,13 +852,13 @@ namespace Plugin
     {
         if (const auto ImModifier = GetKeyModifier(Key); ImModifier != ImGuiMod_None)
         {
-            ImGui::GetIO().AddKeyEvent(ImModifier, true);
+            Enqueue({ .Type = Event::Kind::Key, .Down = true, .Code = static_cast<UInt32>(ImModifier) });
         }
         if (const auto ImKey = GetKey(Key); ImKey != ImGuiKey_None)
         {
-            ImGui::GetIO().AddKeyEvent(ImKey, true);
+            Enqueue({ .Type = Event::Kind::Key, .Down = true, .Code = static_cast<UInt32>(ImKey) });
         }
-        return ImGui::GetIO().WantCaptureKeyboard;
+        return mCaptureKeys.load(std::memory_order_relaxed);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -427,8 +866,8 @@ namespace Plugin
 
     Bool ImGuiSystem::OnMouseMove(Real32 X, Real32 Y, Real32 DeltaX, Real32 DeltaY)
     {
-        ImGui::GetIO().AddMousePosEvent(X, Y);
-        return ImGui::GetIO().WantCaptureMouse;
+        Enqueue({ .Type = Event::Kind::MouseMove, .X = X, .Y = Y });
+        return mCaptureMouse.load(std::memory_order_relaxed);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -436,8 +875,8 @@ namespace Plugin
 
     Bool ImGuiSystem::OnMouseScroll(Real32 DeltaX, Real32 DeltaY)
     {
-        ImGui::GetIO().AddMouseWheelEvent(DeltaX, DeltaY);
-        return ImGui::GetIO().WantCaptureMouse;
+        Enqueue({ .Type = Event::Kind::MouseScroll, .X = DeltaX, .Y = DeltaY });
+        return mCaptureMouse.load(std::memory_order_relaxed);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -447,9 +886,9 @@ namespace Plugin
     {
         if (const auto ImButton = GetButton(Button); ImButton >= 0)
         {
-            ImGui::GetIO().AddMouseButtonEvent(ImButton, false);
+            Enqueue({ .Type = Event::Kind::MouseButton, .Down = false, .Code = static_cast<UInt32>(ImButton) });
         }
-        return ImGui::GetIO().WantCaptureMouse;
+        return mCaptureMouse.load(std::memory_order_relaxed);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -459,9 +898,9 @@ namespace Plugin
     {
         if (const auto ImButton = GetButton(Button); ImButton >= 0)
         {
-            ImGui::GetIO().AddMouseButtonEvent(ImButton, true);
+            Enqueue({ .Type = Event::Kind::MouseButton, .Down = true, .Code = static_cast<UInt32>(ImButton) });
         }
-        return ImGui::GetIO().WantCaptureMouse;
+        return mCaptureMouse.load(std::memory_order_relaxed);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -469,7 +908,7 @@ namespace Plugin
 
     Bool ImGuiSystem::OnWindowFocus(Bool Focused)
     {
-        ImGui::GetIO().AddFocusEvent(Focused);
+        Enqueue({ .Type = Event::Kind::Focus, .Down = Focused });
         return false;
     }
 
@@ -478,7 +917,7 @@ namespace Plugin
 
     Bool ImGuiSystem::OnWindowResize(UInt32 Width, UInt32 Height)
     {
-        ImGui::GetIO().DisplaySize = ImVec2(static_cast<Real32>(Width), static_cast<Real32>(Height));
+        Enqueue({ .Type = Event::Kind::Resize, .X = static_cast<Real32>(Width), .Y = static_cast<Real32>(Height) });
         return false;
     }
 }
\ No newline at end of file
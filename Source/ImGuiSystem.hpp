@@ -12,8 +12,12 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "ImGuiRenderer.hpp"
+#include "ImGuiAllocator.hpp"
+#include "ImGuiQueue.hpp"
+#include "ImGuiRemote.hpp"
+#include "ImGuiSettings.hpp"
 #include <Zyphryon.Input/Common.hpp>
+#include <chrono>
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -22,8 +26,36 @@
 namespace Plugin
 {
     /// System for managing ImGui integration with the engine.
+    ///
+    /// Every system owns its own ImGui context, so several independent UIs can coexist and each can build its
+    /// frame on a different thread. \ref Begin and \ref End make the system's context current on the calling thread.
+    /// Input handlers only queue events, which \ref Begin feeds to ImGui, so input may arrive from any single thread.
     class ImGuiSystem final
     {
+    public:
+
+        /// \brief Counters gathered while building and submitting a frame.
+        struct Statistics
+        {
+            /// CPU time spent starting the frame in ImGui, in milliseconds.
+            Real64                     NewFrameTime = 0.0;
+
+            /// CPU time spent finalizing the frame's draw data in ImGui, in milliseconds.
+            Real64                     RenderTime   = 0.0;
+
+            /// CPU time spent translating and submitting the draw data, in milliseconds.
+            Real64                     SubmitTime   = 0.0;
+
+            /// Number of allocations ImGui made while the frame was built, across every system of the process.
+            UInt32                     Allocations  = 0;
+
+            /// Counters of ImGui's memory, as of the end of the frame.
+            ImGuiAllocator::Statistics Memory;
+
+            /// Counters gathered by the renderer while submitting the frame.
+            ImGuiRenderer::Statistics  Renderer;
+        };
+
     public:
 
         /// Initializes the ImGui system with the specified host.
@@ -38,46 +70,305 @@ namespace Plugin
 
         /// Begins a new ImGui frame.
         ///
+        /// In lazy mode, or before the refresh period elapses, the frame is skipped when nothing changed since the last
+        /// rebuild, in which case the caller must not issue any ImGui call until \ref End replays the previous frame
+        /// (see \ref IsRebuilding).
+        ///
         /// \param Time The current frame time in seconds.
         void Begin(Real64 Time);
 
         /// Ends the current ImGui frame and submits rendering commands.
         void End();
 
+        /// Adds a font whose glyphs are baked once as signed distance fields and drawn sharp at any size.
+        ///
+        /// \param Data The contents of the TrueType font file, which are copied.
+        /// \param Size The reference size in pixels the glyphs are baked at.
+        /// \return The font, or `nullptr` if it could not be loaded.
+        Ptr<ImFont> AddDistanceFont(ConstSpan<Byte> Data, Real32 Size);
+
+        /// Sets the directory where baked glyphs are cached, so later runs skip baking them again.
+        ///
+        /// Must be called before the fonts are added. Changing a font or its settings invalidates its cache file.
+        ///
+        /// \param Directory The existing directory used to store cache files, or empty to disable the cache.
+        void SetFontCache(Text Directory);
+
+        /// Enables or disables lazy mode, which skips rebuilding the UI while it is idle.
+        ///
+        /// \param Lazy `true` to skip idle frames, `false` to rebuild the UI every frame.
+        void SetLazy(Bool Lazy);
+
+        /// Sets the rate at which the UI is rebuilt, independently of the engine's frame rate.
+        ///
+        /// Frames in between replay the last rebuilt frame, which only re-issues the draw commands recorded for it (see
+        /// \ref ImGuiRenderer::Resubmit). Input forces an immediate rebuild.
+        ///
+        /// \param Rate The number of rebuilds per second, or `0` to rebuild the UI every frame.
+        void SetRefreshRate(Real64 Rate);
+
+        /// Sets the file the layout and settings of the UI are persisted to, see \ref ImGuiSettings.
+        ///
+        /// Must be called before \ref Initialize.
+        ///
+        /// \param Path The path of the settings file, or empty to disable persistence.
+        void SetSettingsPath(Text Path)
+        {
+            mSettingsPath = Path;
+        }
+
+        /// Marks the UI as dirty, forcing the next frame to be rebuilt in lazy mode.
+        void Invalidate();
+
+        /// Shows or hides a window graphing the system's statistics over the last frames.
+        ///
+        /// \param Overlay `true` to draw the statistics window, `false` otherwise.
+        void SetOverlay(Bool Overlay)
+        {
+            mOverlay = Overlay;
+        }
+
+        /// Sets how long a window must stay hidden before ImGui releases its draw buffers.
+        ///
+        /// \param Seconds The time after which the buffers of a hidden window are released, `60` by default.
+        void SetCompactTimer(Real32 Seconds)
+        {
+            mCompactTimer = Seconds;
+        }
+
+        /// Sets the amount of memory ImGui should stay within.
+        ///
+        /// While ImGui holds more memory than the budget, every frame releases the draw buffers of all hidden windows
+        /// right away, then returns the pooled memory no longer in use to the heap. The budget is checked against the
+        /// memory of every system of the process, since they share the allocator (see \ref ImGuiAllocator).
+        ///
+        /// \param Bytes The number of bytes ImGui should stay within, or `0` for no budget.
+        void SetMemoryBudget(UInt64 Bytes)
+        {
+            mMemoryBudget = Bytes;
+        }
+
+        /// Starts recording every submitted frame to a capture file, see \ref ImGuiCapture.
+        ///
+        /// \param Path The path of the capture file to create.
+        /// \return `true` if the capture file was created, `false` otherwise.
+        Bool StartCapture(Text Path)
+        {
+            return mCapture.Open(Path);
+        }
+
+        /// Stops recording frames and closes the capture file.
+        void StopCapture()
+        {
+            mCapture.Close();
+        }
+
+        /// Streams the UI to a remote viewer instead of rendering it, for builds without a display.
+        ///
+        /// Must be called before \ref Initialize. The UI is built as usual, but driven by the viewer's input only.
+        /// Viewers are not authenticated, so the port only accepts local viewers unless another address is given.
+        ///
+        /// \param Port    The TCP port to accept the viewer on.
+        /// \param Address The numeric address of the interface to accept the viewer on.
+        /// \return `true` if the port is being listened on, `false` otherwise.
+        Bool Serve(UInt16 Port, Text Address = "127.0.0.1");
+
+        /// Turns the system into a viewer of a remote UI, which renders the frames it receives and sends its input.
+        ///
+        /// Must be called after \ref Initialize. \ref IsRebuilding then always returns `false`, since no UI is built
+        /// locally.
+        ///
+        /// \param Address The numeric address of the server (e.g. `127.0.0.1`).
+        /// \param Port    The TCP port the server listens on.
+        /// \return `true` if the connection was established, `false` otherwise.
+        Bool Connect(Text Address, UInt16 Port);
+
+        /// Retrieves the renderer of the system, e.g. to replay captured frames through it.
+        ///
+        /// \return The renderer of the system.
+        Ref<ImGuiRenderer> GetRenderer()
+        {
+            return mRenderer;
+        }
+
+        /// Retrieves the counters gathered during the last frame.
+        ///
+        /// \return The statistics of the last frame.
+        ConstRef<Statistics> GetStatistics() const
+        {
+            return mStatistics;
+        }
+
+        /// Checks whether the renderer has finished compiling its techniques, so frames are actually drawn.
+        ///
+        /// \return `true` if frames are drawn (or streamed, for a served UI), `false` otherwise.
+        Bool IsReady() const
+        {
+            return mRemote.GetRole() == ImGuiRemote::Role::Server || mRenderer.IsReady();
+        }
+
+        /// Retrieves the time from \ref Initialize until the first frame was drawn, to measure startup.
+        ///
+        /// \return The time to the first drawn frame in milliseconds, or `0` if no frame was drawn yet.
+        Real64 GetStartupTime() const
+        {
+            return mStartupTime;
+        }
+
+        /// Checks whether the frame started by \ref Begin is being rebuilt, so UI code has to run.
+        ///
+        /// \return `true` if the frame is being rebuilt, `false` if \ref End replays the previous frame.
+        Bool IsRebuilding() const
+        {
+            return !mReplay;
+        }
+
+        /// Retrieves the number of frames skipped by lazy mode.
+        ///
+        /// \return The number of frames replayed instead of rebuilt.
+        UInt64 GetSkippedFrames() const
+        {
+            return mSkippedFrames;
+        }
+
     private:
 
+        /// \brief Describes an input event recorded by the handlers until the next frame consumes it.
+        struct Event
+        {
+            /// \brief Kinds of input events.
+            enum class Kind : UInt8
+            {
+                Key,         ///< A key, or key modifier, was pressed or released.
+                Character,   ///< A character was typed.
+                MouseMove,   ///< The mouse moved to a new position.
+                MouseScroll, ///< The mouse wheel scrolled.
+                MouseButton, ///< A mouse button was pressed or released.
+                Focus,       ///< The window gained or lost focus.
+                Resize,      ///< The window was resized.
+            };
+
+            /// The kind of the event.
+            Kind   Type;
+
+            /// Whether the key or button was pressed, or the window gained focus.
+            Bool   Down;
+
+            /// The key, button or character codepoint.
+            UInt32 Code;
+
+            /// The position, scroll delta or size, depending on the kind of the event.
+            Real32 X, Y;
+        };
+
+        /// Number of bytes an input event takes on the wire, see \ref Encode.
+        static constexpr UInt32 kEventSize = 14;
+
+        /// Writes an input event field by field, in the layout viewers send to the server.
+        ///
+        /// \param Value  The event to write.
+        /// \param Output The buffer receiving the event.
+        static void Encode(ConstRef<Event> Value, Ref<Array<Byte, kEventSize>> Output);
+
+        /// Reads an input event written by \ref Encode, rejecting a flag byte that is neither `0` nor `1`.
+        ///
+        /// \param Payload The bytes received from the viewer.
+        /// \param Value   The event receiving the fields read.
+        /// \return `true` if the payload holds a well formed event, `false` otherwise.
+        static Bool Decode(ConstSpan<Byte> Payload, Ref<Event> Value);
+
+        /// Checks whether an input event received from a viewer can be safely fed to ImGui.
+        ///
+        /// \param Value The event to check.
+        /// \return `true` if the event has a known kind and its key, button or size is in range, `false` otherwise.
+        static Bool IsValid(ConstRef<Event> Value);
+
+        /// Feeds every queued input event to ImGui, merging consecutive mouse movements and scroll deltas.
+        ///
+        /// \param IO The IO of the system's context.
+        void Drain(Ref<ImGuiIO> IO);
+
+        /// Sends the queued input events to the server and renders the frames received from it.
+        void View();
+
+        /// Draws the statistics window, graphing the frames recorded so far.
+        void DrawOverlay();
+
+        /// Queues an input event and marks the UI as dirty.
+        ///
+        /// \param Value The event to queue.
+        void Enqueue(ConstRef<Event> Value);
+
         /// \brief Handles text input events.
-        static Bool OnKeyType(Text Text);
+        Bool OnKeyType(Text Text);
 
         /// \brief Handles key release events.
-        static Bool OnKeyUp(Input::Key Key);
+        Bool OnKeyUp(Input::Key Key);
 
         /// \brief Handles key press events.
-        static Bool OnKeyDown(Input::Key Key);
+        Bool OnKeyDown(Input::Key Key);
 
         /// \brief Handles mouse movement events.
-        static Bool OnMouseMove(Real32 X, Real32 Y, Real32 DeltaX, Real32 DeltaY);
+        Bool OnMouseMove(Real32 X, Real32 Y, Real32 DeltaX, Real32 DeltaY);
 
         /// \brief Handles mouse scroll events.
-        static Bool OnMouseScroll(Real32 DeltaX, Real32 DeltaY);
+        Bool OnMouseScroll(Real32 DeltaX, Real32 DeltaY);
 
         /// \brief Handles mouse button release events.
-        static Bool OnMouseUp(Input::Button Button);
+        Bool OnMouseUp(Input::Button Button);
 
         /// \brief Handles mouse button press events.
-        static Bool OnMouseDown(Input::Button Button);
+        Bool OnMouseDown(Input::Button Button);
 
         /// \brief Handles window focus change events.
-        static Bool OnWindowFocus(Bool Focused);
+        Bool OnWindowFocus(Bool Focused);
 
         /// \brief Handles window resize events.
-        static Bool OnWindowResize(UInt32 Width, UInt32 Height);
+        Bool OnWindowResize(UInt32 Width, UInt32 Height);
+
+    private:
+
+        /// Number of seconds the UI keeps rebuilding after the last change, to let animations and timers settle.
+        static constexpr Real64 kLazyTimeout = 1.0;
+
+        /// Maximum number of input events queued between two frames.
+        static constexpr UInt32 kEventCapacity = 4096;
+
+        /// Number of frames kept by the statistics window.
+        static constexpr UInt32 kHistorySize   = 240;
 
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        ImGuiRenderer mRenderer;
+        Ptr<ImGuiContext>                  mContext       = nullptr;
+        ImGuiQueue<Event, kEventCapacity>  mEvents;
+        std::atomic<Bool>                  mCaptureKeys   = false;
+        std::atomic<Bool>                  mCaptureMouse  = false;
+        ImGuiRenderer                      mRenderer;
+        Bool                               mLazy          = false;
+        std::atomic<Bool>                  mDirty         = true;
+        Bool                               mReplay        = false;
+        Real64                             mIdleTime      = 0.0;
+        Real64                             mPendingTime   = 0.0;
+        Real64                             mRefreshPeriod = 0.0;
+        UInt64                             mSkippedFrames = 0;
+        Statistics                         mStatistics;
+        Bool                               mOverlay       = false;
+        Array<Real32, kHistorySize>        mHistoryTime   { };
+        Array<Real32, kHistorySize>        mHistoryCount  { };
+        Array<Real32, kHistorySize>        mHistoryBytes  { };
+        UInt32                             mHistoryOffset = 0;
+        ImGuiCapture                       mCapture;
+        ImGuiRemote                        mRemote;
+        ImGuiReplay                        mViewer;
+        Str                                mSettingsPath  = "imgui.ini";
+        ImGuiSettings                      mSettings;
+        std::chrono::steady_clock::time_point mStartup;
+        Real64                             mStartupTime   = 0.0;
+        Real32                             mCompactTimer  = 60.0f;
+        UInt64                             mMemoryBudget  = 0;
+        UInt64                             mAllocations   = 0;
     };
 }
\ No newline at end of file
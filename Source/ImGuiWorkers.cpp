@@ -0,0 +1,210 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "ImGuiWorkers.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// \brief State of the pool shared by every renderer.
+    struct ImGuiWorkersState
+    {
+        /// Serializes taking and dropping references, which start and stop the threads.
+        std::mutex              Lifetime;
+
+        /// Held by the renderer whose loop runs on the threads, so loops of other renderers never wait for it.
+        std::mutex              Owner;
+
+        /// Number of references taken on the pool.
+        UInt32                  References = 0;
+
+        /// Threads of the pool.
+        Vector<std::thread>     Threads;
+
+        /// Guards the loop state below.
+        std::mutex              Mutex;
+
+        /// Wakes the threads when a loop is dispatched or the pool is stopped.
+        std::condition_variable Wake;
+
+        /// Wakes the dispatching thread once every thread is done with the loop.
+        std::condition_variable Idle;
+
+        /// Whether the threads keep waiting for loops.
+        Bool                    Running    = false;
+
+        /// Number of loops dispatched so far.
+        UInt64                  Generation = 0;
+
+        /// Number of threads still taking part in the current loop.
+        UInt32                  Busy       = 0;
+
+        /// Function invoked for every iteration of the current loop.
+        void (* Action)(Ptr<void>, UInt32) = nullptr;
+
+        /// State passed to the function.
+        Ptr<void>               Context    = nullptr;
+
+        /// Number of iterations of the current loop.
+        UInt32                  Count      = 0;
+
+        /// Next iteration of the current loop to hand out.
+        std::atomic<UInt32>     Next       = 0;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ref<ImGuiWorkersState> GetState()
+    {
+        // Never destroyed, threads still running at exit belong to renderers that were never disposed.
+        static const Ptr<ImGuiWorkersState> State = new ImGuiWorkersState();
+        return * State;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Execute(Ref<ImGuiWorkersState> State)
+    {
+        for (UInt32 Index; (Index = State.Next.fetch_add(1, std::memory_order_relaxed)) < State.Count;)
+        {
+            State.Action(State.Context, Index);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Loop(Ref<ImGuiWorkersState> State, UInt64 Generation)
+    {
+        std::unique_lock Guard(State.Mutex);
+
+        while (true)
+        {
+            State.Wake.wait(Guard, [&] { return !State.Running || State.Generation != Generation; });
+
+            if (!State.Running)
+            {
+                break;
+            }
+            Generation = State.Generation;
+
+            Guard.unlock();
+            Execute(State);
+            Guard.lock();
+
+            if (--State.Busy == 0)
+            {
+                State.Idle.notify_one();
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiWorkers::Acquire()
+    {
+        Ref<ImGuiWorkersState> State = GetState();
+
+        const std::lock_guard Guard(State.Lifetime);
+
+        if (State.References++ > 0)
+        {
+            return;
+        }
+
+        // The calling thread takes part in every loop, so it is not counted.
+        const UInt32 Hardware = std::thread::hardware_concurrency();
+        const UInt32 Count    = Min(Max(Hardware, 1u) - 1, kMaximumThreads);
+
+        State.Running = true;
+
+        for (UInt32 Index = 0; Index < Count; ++Index)
+        {
+            State.Threads.emplace_back(&Loop, std::ref(State), State.Generation);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiWorkers::Release()
+    {
+        Ref<ImGuiWorkersState> State = GetState();
+
+        const std::lock_guard Guard(State.Lifetime);
+
+        if (State.References == 0 || --State.References > 0)
+        {
+            return;
+        }
+
+        {
+            const std::lock_guard Lock(State.Mutex);
+            State.Running = false;
+        }
+        State.Wake.notify_all();
+
+        for (Ref<std::thread> Thread : State.Threads)
+        {
+            Thread.join();
+        }
+        State.Threads.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ImGuiWorkers::Dispatch(UInt32 Count, Task Action, Ptr<void> Context)
+    {
+        Ref<ImGuiWorkersState> State = GetState();
+
+        // Another renderer owns the threads, or none were started, so the loop runs on the calling thread alone.
+        std::unique_lock Owner(State.Owner, std::try_to_lock);
+
+        if (!Owner.owns_lock() || State.Threads.empty())
+        {
+            for (UInt32 Index = 0; Index < Count; ++Index)
+            {
+                Action(Context, Index);
+            }
+            return;
+        }
+
+        {
+            const std::lock_guard Guard(State.Mutex);
+            State.Action  = Action;
+            State.Context = Context;
+            State.Count   = Count;
+            State.Busy    = static_cast<UInt32>(State.Threads.size());
+            State.Next.store(0, std::memory_order_relaxed);
+            ++State.Generation;
+        }
+        State.Wake.notify_all();
+
+        Execute(State);
+
+        // The loop state lives on the caller's stack, so wait until every thread is done with it.
+        std::unique_lock Guard(State.Mutex);
+        State.Idle.wait(Guard, [&] { return State.Busy == 0; });
+    }
+}
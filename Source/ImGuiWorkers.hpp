@@ -0,0 +1,76 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2026 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Plugin
+{
+    /// \brief Process-wide pool of threads that run the iterations of a loop alongside the calling thread.
+    ///
+    /// The threads are started once and sleep between loops, so spreading a frame across them costs a wake up rather
+    /// than a thread creation. Iterations are handed out one at a time through an atomic counter, which balances draw
+    /// lists of very different sizes, and the calling thread takes part until every iteration has completed.
+    ///
+    /// A single pool is shared by every renderer of the process, so several systems never start more threads than
+    /// the hardware has. While one renderer runs a loop on it, a loop dispatched by another runs on its calling thread.
+    class ImGuiWorkers final
+    {
+    public:
+
+        /// Most threads started by the pool, besides the calling thread.
+        static constexpr UInt32 kMaximumThreads = 7;
+
+    public:
+
+        /// Takes a reference on the pool, starting its threads on the first one.
+        ///
+        /// The pool starts one thread per hardware thread besides the calling one, up to \ref kMaximumThreads.
+        static void Acquire();
+
+        /// Drops a reference on the pool, stopping its threads once the last one is dropped.
+        static void Release();
+
+        /// Runs every iteration of a loop, and returns once all of them have completed.
+        ///
+        /// Must not be called from a thread of the pool.
+        ///
+        /// \param Count    The number of iterations.
+        /// \param Callback The function invoked with the index of each iteration, from any thread of the pool.
+        template<typename Function>
+        static void Run(UInt32 Count, Function && Callback)
+        {
+            const auto Trampoline = [](Ptr<void> Context, UInt32 Index)
+            {
+                (* static_cast<Ptr<std::remove_reference_t<Function>>>(Context))(Index);
+            };
+            Dispatch(Count, Trampoline, AddressOf(Callback));
+        }
+
+    private:
+
+        /// Function invoked for every iteration of a loop.
+        using Task = void (*)(Ptr<void> Context, UInt32 Index);
+
+        /// Hands a loop to the threads of the pool and takes part in it, or runs it alone while the pool is busy.
+        ///
+        /// \param Count   The number of iterations.
+        /// \param Action  The function invoked for every iteration.
+        /// \param Context The state passed to the function.
+        static void Dispatch(UInt32 Count, Task Action, Ptr<void> Context);
+    };
+}